@@ -0,0 +1,104 @@
+/**
+
+@file       batch.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures the throughput of the batch overloads of batch.h, in elements per second, against a loop over the scalar functions,
+along with the largest error of each batch function against the long double functions of the C library,
+and the number of elements on which an in-place call differs from an out-of-place one, over inputs partly outside the lane kernels' domains.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -mavx -DJML_REAL=double -Iinclude -I<JUtil>/include bench/batch.cpp -o batch && ./batch
+
+Drop -mavx to measure the SSE2 lanes.
+
+*/
+
+#include <JML/batch.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+///@return The distance of @param x from @param ref, in units in the last place of T.
+template <typename T>
+double ulps(T x, long double ref) {
+    if (!(std::fabs(ref) <= std::numeric_limits<T>::max())) return 0;
+    int e;
+    std::frexp(ref, &e);
+    e = (e < std::numeric_limits<T>::min_exponent? std::numeric_limits<T>::min_exponent : e);
+    return static_cast<double>(std::fabs(static_cast<long double>(x) - ref) / std::ldexp(1.0L, e - std::numeric_limits<T>::digits));
+}
+
+template <typename T, typename B, typename S, typename R>
+void run(const char *name, B batch, S scalar, R reference, double lo, double hi) {
+    const size_t n = 1 << 16;
+    //The scalar loop runs fewer times, as the scalar inverse functions are far slower.
+    const int reps = 100, scalarReps = 10;
+    std::vector<T> x(n), r(n), s(n);
+    for (size_t i = 0; i < n; ++i) {
+        double u = i * 0.6180339887498949;
+        x[i] = static_cast<T>(lo + (hi - lo) * (u - static_cast<size_t>(u)));
+    }
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < reps; ++k) {
+        batch(x.data(), r.data(), n);
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    for (int k = 0; k < scalarReps; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            s[i] = static_cast<T>(scalar(static_cast<jml::Real>(x[i])));
+        }
+    }
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+    double error = 0;
+    for (size_t i = 0; i < n; ++i) {
+        double e = ulps(r[i], reference(static_cast<long double>(x[i])));
+        error = (e > error? e : error);
+    }
+    //Every fifth element is pushed out of the domain of the lane kernels, and an in-place call must match an out-of-place one.
+    std::vector<T> y(x), t(n);
+    for (size_t i = 0; i < n; i += 5) {
+        y[i] = static_cast<T>(y[i] * 1e30);
+    }
+    batch(y.data(), t.data(), n);
+    batch(y.data(), y.data(), n);
+    size_t differ = 0;
+    for (size_t i = 0; i < n; ++i) {
+        differ += (y[i] != t[i] && !(y[i] != y[i] && t[i] != t[i]));
+    }
+    double b = reps * n / std::chrono::duration<double>(t1 - t0).count(), c = scalarReps * n / std::chrono::duration<double>(t2 - t1).count();
+    printf("%-6s %-8s batch %8.1f M/s   scalar %7.1f M/s   x%5.1f   max error %.2f ULP   in place %zu wrong\n", (sizeof(T) == 4? "float" : "double"), name, b / 1e6, c / 1e6, b / c, error, differ);
+}
+
+long double sigmoidL(long double x) {return 1 / (1 + std::exp(-x));}
+long double log2L(long double x) {return std::log2(x);}
+
+#define RUN(T, f, ref, lo, hi) run<T>(#f, \
+    [](const T *x, T *r, size_t n) {jml::f(x, r, n);}, \
+    [](jml::Real v) {return jml::f(v);}, \
+    [](long double v) {return ref(v);}, lo, hi)
+
+template <typename T>
+void all() {
+    RUN(T, sin, std::sin, -100, 100);
+    RUN(T, cos, std::cos, -100, 100);
+    RUN(T, tan, std::tan, -100, 100);
+    RUN(T, asin, std::asin, -1, 1);
+    RUN(T, acos, std::acos, -1, 1);
+    RUN(T, atan, std::atan, -10, 10);
+    RUN(T, exp, std::exp, -80, 80);
+    RUN(T, ln, std::log, 1e-3, 1e3);
+    RUN(T, log2, log2L, 1e-3, 1e3);
+    RUN(T, sigmoid, sigmoidL, -20, 20);
+    RUN(T, tanh, std::tanh, -5, 5);
+}
+
+int main() {
+    all<float>();
+    all<double>();
+}
@@ -0,0 +1,116 @@
+/**
+
+@file       kdtree.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures KDTree against brute force on uniform random 3D float points, from 10^4 to 10^7 points:
+the build time, and the time per query of 1-NN, 8-NN and radius queries, against a linear scan over squared distances
+and a linear scan over distance(). The 1-NN answers to the scanned queries are checked against the scan.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -Iinclude -I<JUtil>/include bench/kdtree.cpp -o kdtree && ./kdtree
+
+Add -DJML_THREADS -pthread to time the threaded build as well. 10^7 points take about 700 MB.
+
+*/
+
+#include <JML/KDTree.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+typedef jml::KDTree3f Tree;
+typedef Tree::PointType Point;
+
+///Keeps the results of the brute force scans alive.
+volatile float sink;
+
+double seconds(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+///@return The point of @param p nearest to @param q, by a scan over squared distances.
+Tree::Neighbour scan(const std::vector<Point> &p, const Point &q) {
+    Tree::Neighbour best = {0, 3.4e38f};
+    for (size_t i = 0; i < p.size(); ++i) {
+        float x = p[i][0] - q[0], y = p[i][1] - q[1], z = p[i][2] - q[2], d = x * x + y * y + z * z;
+        if (d < best.distanceSquared) {
+            best.index = i;
+            best.distanceSquared = d;
+        }
+    }
+    return best;
+}
+
+int main() {
+    std::mt19937 g(1);
+    std::uniform_real_distribution<float> u(0, 1);
+    printf("%9s %9s %9s %9s %9s %11s %11s %9s\n", "n", "build", "1-NN", "8-NN", "radius", "brute d^2", "brute dist", "wrong");
+    for (size_t n = 10000; n <= 10000000; n *= 10) {
+        std::vector<Point> points(n), queries(1000);
+        for (size_t i = 0; i < n; ++i) {
+            points[i] = Point({u(g), u(g), u(g)});
+        }
+        for (size_t i = 0; i < queries.size(); ++i) {
+            queries[i] = Point({u(g), u(g), u(g)});
+        }
+
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        Tree tree(points.begin(), points.end());
+        double build = seconds(t0);
+
+        #ifdef JML_THREADS
+        t0 = std::chrono::steady_clock::now();
+        Tree threaded(points.begin(), points.end(), 8);
+        printf("%9zu threaded build %.3f s\n", n, seconds(t0));
+        #endif
+
+        jutil::Queue<Tree::Neighbour> out;
+        size_t found = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            found += tree.nearest(queries[i]).index;
+        }
+        double one = seconds(t0) / queries.size();
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            tree.nearest(queries[i], 8, out);
+            found += out.size();
+        }
+        double eight = seconds(t0) / queries.size();
+        //The radius holds about 16 points on average.
+        float r = static_cast<float>(std::cbrt(16 / (n * 4.18879)));
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            tree.radius(queries[i], r, out);
+            found += out.size();
+        }
+        double ball = seconds(t0) / queries.size();
+
+        //The scans are slow at large n, so they take fewer queries.
+        size_t m = (n >= 1000000? 20 : 200), wrong = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < m; ++i) {
+            //Ties may be broken either way, so the distances are compared.
+            wrong += (scan(points, queries[i]).distanceSquared != tree.nearest(queries[i]).distanceSquared);
+        }
+        double brute = seconds(t0) / m;
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < m; ++i) {
+            float best = 3.4e38f;
+            for (size_t j = 0; j < n; ++j) {
+                float d = static_cast<float>(jml::distance(points[j], queries[i]));
+                best = (d < best? d : best);
+            }
+            sink = best;
+        }
+        double distance = seconds(t0) / m;
+        sink = static_cast<float>(found);
+        printf("%9zu %8.3fs %7.2fus %7.2fus %7.2fus %9.1fus %9.1fus %9zu\n", n, build, one * 1e6, eight * 1e6, ball * 1e6, brute * 1e6, distance * 1e6, wrong);
+    }
+}
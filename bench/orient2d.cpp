@@ -0,0 +1,112 @@
+/**
+
+@file       orient2d.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures the orientation predicates of predicates.h against the epsilon test ccw() made before them, in triples per second,
+on random triples and on the near-collinear grid of Shewchuk: a = (0.5 + i 2^-53, 0.5 + j 2^-53) for i, j < 256, against (12, 12) and (24, 24).
+Each line also counts the triples whose sign differs from the exact sign, which __int128 arithmetic gives, as every coordinate is a multiple of 2^-53.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -Iinclude -I<JUtil>/include bench/orient2d.cpp -o orient2d && ./orient2d
+
+*/
+
+#include <JML/Maths.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using jml::Vertex;
+
+///ccw() before predicates.h, kept for comparison.
+inline int8_t oldCcw(const Vertex &p1, const Vertex &p2, const Vertex &p3) {
+    jml::Real r = ((p2.x() - p1.x()) * (p3.y() - p1.y())) - ((p2.y() - p1.y()) * (p3.x() - p1.x()));
+    return jml::compare(r, static_cast<jml::Real>(0));
+}
+
+///@return The exact sign of the orientation of @param a, @param b, @param c, whose coordinates are multiples of 2^-53 below 2^10.
+int exact(const double *a, const double *b, const double *c) {
+    const double scale = 9007199254740992.0;
+    __int128 ax = static_cast<int64_t>(a[0] * scale), ay = static_cast<int64_t>(a[1] * scale);
+    __int128 bx = static_cast<int64_t>(b[0] * scale), by = static_cast<int64_t>(b[1] * scale);
+    __int128 cx = static_cast<int64_t>(c[0] * scale), cy = static_cast<int64_t>(c[1] * scale);
+    __int128 d = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+    return (d > 0) - (d < 0);
+}
+
+///Keeps the timed results alive.
+volatile int sink;
+
+///Triples, both as coordinates and as vertices.
+struct Triples {
+    std::vector<double> p;
+    std::vector<Vertex> v;
+    std::vector<int> sign;
+
+    void add(double ax, double ay, double bx, double by, double cx, double cy) {
+        const double t[6] = {ax, ay, bx, by, cx, cy};
+        p.insert(p.end(), t, t + 6);
+        v.push_back(Vertex({ax, ay, 0, 0}));
+        v.push_back(Vertex({bx, by, 0, 0}));
+        v.push_back(Vertex({cx, cy, 0, 0}));
+        sign.push_back(exact(t, t + 2, t + 4));
+    }
+
+    size_t size() const {
+        return sign.size();
+    }
+};
+
+///Prints the triples per second of @param f over @param t, which returns the sign of triple i, and the count of wrong signs.
+template <typename F>
+void run(const char *name, const Triples &t, F f) {
+    const int reps = 50;
+    int sum = 0;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < reps; ++k) {
+        for (size_t i = 0; i < t.size(); ++i) {
+            sum += f(i);
+        }
+    }
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    sink = sum;
+    size_t wrong = 0;
+    for (size_t i = 0; i < t.size(); ++i) {
+        wrong += (f(i) != t.sign[i]);
+    }
+    printf("  %-18s %7.1f M/s   %6zu of %zu wrong\n", name, reps * t.size() / s / 1e6, wrong, t.size());
+}
+
+void all(const char *name, const Triples &t) {
+    printf("%s\n", name);
+    run("orient2d(double)", t, [&](size_t i) {
+        const double *p = &t.p[i * 6];
+        double r = jml::orient2d(p[0], p[1], p[2], p[3], p[4], p[5]);
+        return (r > 0) - (r < 0);
+    });
+    run("ccw(Vertex)", t, [&](size_t i) {return static_cast<int>(jml::ccw(t.v[i * 3], t.v[i * 3 + 1], t.v[i * 3 + 2]));});
+    run("old epsilon ccw", t, [&](size_t i) {return static_cast<int>(oldCcw(t.v[i * 3], t.v[i * 3 + 1], t.v[i * 3 + 2]));});
+}
+
+int main() {
+    std::mt19937_64 g(1);
+    //Multiples of 2^-53 in [0, 1), so that the exact sign is known.
+    std::uniform_int_distribution<uint64_t> u(0, (1ULL << 53) - 1);
+    const double ulp = 1.0 / 9007199254740992.0;
+    Triples random, grid;
+    for (size_t i = 0; i < 65536; ++i) {
+        random.add(u(g) * ulp, u(g) * ulp, u(g) * ulp, u(g) * ulp, u(g) * ulp, u(g) * ulp);
+    }
+    for (size_t i = 0; i < 256; ++i) {
+        for (size_t j = 0; j < 256; ++j) {
+            grid.add(0.5 + i * ulp, 0.5 + j * ulp, 12, 12, 24, 24);
+        }
+    }
+    all("random triples in [0, 1)^2", random);
+    all("near-collinear grid", grid);
+}
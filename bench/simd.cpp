@@ -0,0 +1,102 @@
+/**
+
+@file       simd.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures the kernels of simd.h: the time per call of _dot4, _mulMat4Vec4 and _mulMat4Mat4 on float and double data,
+over arrays of operands large enough that no call can be folded into the next.
+
+The kernels are chosen at compile time, so the bench is built once with and once without JML_NO_SIMD, and the two runs compared.
+Each line ends with a checksum of the results, which the two builds should agree on to within rounding.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -mavx -Iinclude -I<JUtil>/include bench/simd.cpp -o simd && ./simd
+    g++ -std=gnu++11 -O2 -mavx -DJML_NO_SIMD -Iinclude -I<JUtil>/include bench/simd.cpp -o simd-scalar && ./simd-scalar
+
+Drop -mavx to measure the SSE2 kernels.
+
+*/
+
+#include <JML/simd.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+///Keeps the timed results alive.
+volatile double sink;
+
+const size_t count = 1 << 12;
+const int reps = 2000;
+
+template <typename F>
+double time(F f) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < reps; ++k) {
+        f();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / (static_cast<double>(reps) * count);
+}
+
+template <typename T>
+void run(const char *type) {
+    std::vector<T> a(count * 16), b(count * 16), r(count * 16);
+    for (size_t i = 0; i < a.size(); ++i) {
+        double u = i * 0.6180339887498949, v = i * 0.7548776662466927;
+        a[i] = static_cast<T>(u - static_cast<size_t>(u) - 0.5);
+        b[i] = static_cast<T>(v - static_cast<size_t>(v) - 0.5);
+    }
+    double sum = 0, check;
+
+    double dot = time([&]() {
+        T s = 0;
+        for (size_t i = 0; i < count; ++i) {
+            s += jml::_dot4(&a[i * 4], &b[i * 4]);
+        }
+        sum += s;
+    });
+    check = 0;
+    for (size_t i = 0; i < count; ++i) {
+        check += jml::_dot4(&a[i * 4], &b[i * 4]);
+    }
+    printf("%-6s _dot4          %6.2f ns   checksum %.9g\n", type, dot, check);
+
+    double vec = time([&]() {
+        for (size_t i = 0; i < count; ++i) {
+            jml::_mulMat4Vec4(&a[i * 16], &b[i * 4], &r[i * 4]);
+        }
+        sum += r[count];
+    });
+    check = 0;
+    for (size_t i = 0; i < count * 4; ++i) {
+        check += r[i];
+    }
+    printf("%-6s _mulMat4Vec4   %6.2f ns   checksum %.9g\n", type, vec, check);
+
+    double mat = time([&]() {
+        for (size_t i = 0; i < count; ++i) {
+            jml::_mulMat4Mat4(&a[i * 16], &b[i * 16], &r[i * 16]);
+        }
+        sum += r[count];
+    });
+    check = 0;
+    for (size_t i = 0; i < count * 16; ++i) {
+        check += r[i];
+    }
+    printf("%-6s _mulMat4Mat4   %6.2f ns   checksum %.9g\n", type, mat, check);
+    sink = sum;
+}
+
+int main() {
+    #if defined(JML_AVX)
+    printf("AVX kernels\n");
+    #elif defined(JML_SSE2)
+    printf("SSE2 kernels\n");
+    #else
+    printf("scalar kernels\n");
+    #endif
+    run<float>("float");
+    run<double>("double");
+}
@@ -0,0 +1,142 @@
+/**
+
+@file       trig.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures jml::sin, jml::cos and jml::tan against the functions of the C library and against the Taylor series they replaced:
+the time per call of each, and the largest error of each in units in the last place of Real, against the long double C library.
+
+Arguments are drawn from |x| < 100, reduced by Cody-Waite, and from 2^20 <= |x| < 10^15, reduced by Payne-Hanek.
+The old series reduces by repeated subtraction of 2 pi, which takes minutes on the second range, so it is only run on the first.
+For a long double Real the reference is itself rounded to long double, so the errors shown may be off by up to 1 ULP.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -DJML_REAL=double -Iinclude -I<JUtil>/include bench/trig.cpp -o trig && ./trig
+
+Leave JML_REAL undefined to measure the long double functions.
+
+*/
+
+#include <JML/Maths.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+typedef jml::Real Real;
+
+///The sine and cosine of the library before trig.h, kept for comparison.
+namespace old {
+    inline Real preptrig(Real a) {
+        while (a > (2 * Real(JML_PI))) {
+            a -= 2 * Real(JML_PI);
+        }
+        while (a < -(2 * Real(JML_PI))) {
+            a += 2 * Real(JML_PI);
+        }
+        return a;
+    }
+
+    inline Real trig(Real x, Real nx, size_t c, int16_t m) {
+        size_t r = c * 2 - (m == JML_TRIG_EVEN? 0 : 1);
+        Real d = (jml::pow(x, r) / jml::factorial(r)) * (c % 2 == 0? jml::sign(m) : -1 * jml::sign(m));
+        if (jml::abs(d) > Real(JML_CUT)) {
+            return trig(x, nx + d, c + 1, m);
+        } else {
+            return nx;
+        }
+    }
+
+    inline Real cos(Real a) {
+        a = preptrig(a);
+        return trig(a, 1, 1, JML_TRIG_EVEN);
+    }
+
+    inline Real sin(Real a) {
+        a = preptrig(a);
+        return trig(a, a, 2, JML_TRIG_ODD);
+    }
+
+    inline Real tan(Real a) {
+        return sin(a) / cos(a);
+    }
+}
+
+///Keeps the timed results alive.
+volatile Real sink;
+
+///@return The distance of @param x from @param ref, in units in the last place of Real.
+double ulps(Real x, long double ref) {
+    if (!(std::fabs(ref) <= std::numeric_limits<Real>::max())) return 0;
+    int e;
+    std::frexp(ref, &e);
+    e = (e < std::numeric_limits<Real>::min_exponent? std::numeric_limits<Real>::min_exponent : e);
+    return static_cast<double>(std::fabs(static_cast<long double>(x) - ref) / std::ldexp(1.0L, e - std::numeric_limits<Real>::digits));
+}
+
+///@return Nanoseconds per call of @param f over @param x.
+template <typename F>
+double time(F f, const std::vector<Real> &x, int reps) {
+    Real sum = 0;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < reps; ++k) {
+        for (size_t i = 0; i < x.size(); ++i) {
+            sum += f(x[i]);
+        }
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    sink = sum;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / (reps * x.size());
+}
+
+///@return The largest error of @param f over @param x against @param ref.
+template <typename F, typename R>
+double error(F f, R ref, const std::vector<Real> &x) {
+    double e = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        double d = ulps(f(x[i]), ref(static_cast<long double>(x[i])));
+        e = (d > e? d : e);
+    }
+    return e;
+}
+
+template <typename J, typename L, typename O, typename R>
+void run(const char *name, const std::vector<Real> &x, bool small, J jml, L libm, O series, R ref) {
+    const int reps = 20;
+    double tj = time(jml, x, reps), tl = time(libm, x, reps), ej = error(jml, ref, x), el = error(libm, ref, x);
+    printf("%-4s jml %7.2f ns %8.2f ULP   libm %7.2f ns %8.2f ULP", name, tj, ej, tl, el);
+    if (small) {
+        printf("   old %8.2f ns %12.4g ULP", time(series, x, 1), error(series, ref, x));
+    }
+    printf("\n");
+}
+
+int main() {
+    std::vector<Real> small(1 << 16), large(1 << 16);
+    for (size_t i = 0; i < small.size(); ++i) {
+        double u = i * 0.6180339887498949, v = i * 0.7548776662466927;
+        u -= static_cast<size_t>(u);
+        v -= static_cast<size_t>(v);
+        small[i] = static_cast<Real>(-100 + 200 * u);
+        large[i] = static_cast<Real>((v < 0.5? -1 : 1) * std::pow(2.0, 20 + (std::log2(1e15) - 20) * u));
+    }
+    printf("Real with a %d-bit mantissa\n", std::numeric_limits<Real>::digits);
+    const char *names[] = {"|x| < 100", "2^20 <= |x| < 10^15"};
+    for (int k = 0; k < 2; ++k) {
+        const std::vector<Real> &x = (k == 0? small : large);
+        printf("%s\n", names[k]);
+        run("sin", x, k == 0,
+            [](Real v) {return jml::sin(v);}, [](Real v) {return static_cast<Real>(std::sin(v));}, [](Real v) {return old::sin(v);},
+            [](long double v) {return std::sin(v);});
+        run("cos", x, k == 0,
+            [](Real v) {return jml::cos(v);}, [](Real v) {return static_cast<Real>(std::cos(v));}, [](Real v) {return old::cos(v);},
+            [](long double v) {return std::cos(v);});
+        run("tan", x, k == 0,
+            [](Real v) {return jml::tan(v);}, [](Real v) {return static_cast<Real>(std::tan(v));}, [](Real v) {return old::tan(v);},
+            [](long double v) {return std::tan(v);});
+    }
+}
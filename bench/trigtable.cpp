@@ -0,0 +1,62 @@
+/**
+
+@file       trigtable.cpp
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Measures the trade-off between latency and error of the trigonometry policies of trigtable.h:
+the time per sincos call of ExactTrig and of TableTrig at several sizes, and the largest error of each against the long double
+functions of the C library.
+
+Build and run, with JUtil on the include path:
+    g++ -std=gnu++11 -O2 -DJML_REAL=double -Iinclude -I<JUtil>/include bench/trigtable.cpp -o trigtable && ./trigtable
+
+*/
+
+#include <JML/trigtable.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+///Keeps the timed results alive.
+volatile jml::Real sink;
+
+template <typename P>
+void run(const char *name, const std::vector<jml::Real> &x) {
+    const int reps = 20;
+    jml::Real sum = 0, s, c;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < reps; ++k) {
+        for (size_t i = 0; i < x.size(); ++i) {
+            jml::sincos<P>(x[i], s, c);
+            sum += s + c;
+        }
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    sink = sum;
+    long double error = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        jml::sincos<P>(x[i], s, c);
+        long double a = static_cast<long double>(x[i]);
+        long double e = std::fabs(static_cast<long double>(s) - std::sin(a)), f = std::fabs(static_cast<long double>(c) - std::cos(a));
+        error = (e > error? e : error);
+        error = (f > error? f : error);
+    }
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (reps * x.size());
+    printf("%-16s %6.2f ns per sincos   max error %.2e\n", name, ns, static_cast<double>(error));
+}
+
+int main() {
+    std::vector<jml::Real> x(1 << 20);
+    for (size_t i = 0; i < x.size(); ++i) {
+        double u = i * 0.6180339887498949;
+        x[i] = static_cast<jml::Real>(-100 + 200 * (u - static_cast<size_t>(u)));
+    }
+    run<jml::ExactTrig>("ExactTrig", x);
+    run<jml::TableTrig<256>>("TableTrig<256>", x);
+    run<jml::TableTrig<1024>>("TableTrig<1024>", x);
+    run<jml::TableTrig<4096>>("TableTrig<4096>", x);
+}
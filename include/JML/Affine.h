@@ -0,0 +1,216 @@
+#ifndef JML_AFFINE_H
+#define JML_AFFINE_H
+
+/**
+
+@file       Affine.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements an Affine3 class for affine transforms in 3D, which stores only the upper 3x4 block of the 4x4 matrix,
+the bottom row of an affine transform always being (0, 0, 0, 1).
+
+It takes 12 values in place of 16, and its kernels skip the products with the constant row:
+    compose:    36 multiplications, in place of 64
+    point:      9 multiplications, in place of 16
+    inverse:    the 3x3 block by cofactors and one product for the translation, in place of a general 4x4 inversion
+
+Conversions to and from Matrix<T, 4, 4> copy the block exactly, so they lose nothing for matrices whose bottom row is (0, 0, 0, 1).
+
+*/
+
+#include <JML/Quaternion.h>
+
+namespace jml {
+
+    ///Writes the product of the affine 3x4 blocks @param a and @param b to @param r, for types without a vectorized kernel in simd.h.
+    template <typename T>
+    inline void _mulAffine3(const T *a, const T *b, T *r) {
+        for (size_t i = 0; i < 12; i += 4) {
+            for (size_t j = 0; j < 4; ++j) {
+                r[i + j] = a[i] * b[j] + a[i + 1] * b[4 + j] + a[i + 2] * b[8 + j];
+            }
+            r[i + 3] += a[i + 3];
+        }
+    }
+
+    /**
+
+    @brief Affine transform of 3D space, as the matrix | A t |, where A is 3x3 and t is the translation.
+    @param T: Scalar type of the elements.
+
+    */
+
+    template <typename T>
+    class Affine3 {
+    public:
+
+        typedef Vector<T, 3> VectorType;
+
+        ///@brief Constructor which creates the identity transform.
+        Affine3() {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    m[i][j] = static_cast<T>(i == j);
+                }
+            }
+        }
+
+        ///@brief Constructor which takes the linear part @param a and the translation @param t.
+        Affine3(const Matrix<T, 3, 3> &a, const VectorType &t) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    m[i][j] = a.get(i, j);
+                }
+                m[i][3] = t[i];
+            }
+        }
+
+        ///@brief Constructor which takes the upper 3x4 block of @param a. Its bottom row is assumed to be (0, 0, 0, 1), not checked.
+        template <typename L>
+        explicit Affine3(const Matrix<T, 4, 4, L> &a) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    m[i][j] = a.get(i, j);
+                }
+            }
+        }
+
+        static Affine3 translation(const VectorType &t) {
+            Affine3 result;
+            for (size_t i = 0; i < 3; ++i) {
+                result.m[i][3] = t[i];
+            }
+            return result;
+        }
+
+        static Affine3 scaling(const VectorType &s) {
+            Affine3 result;
+            for (size_t i = 0; i < 3; ++i) {
+                result.m[i][i] = s[i];
+            }
+            return result;
+        }
+
+        ///@return The rotation by the unit quaternion @param q.
+        static Affine3 rotation(const Quaternion<T> &q) {
+            return Affine3(q.matrix(), VectorType({0, 0, 0}));
+        }
+
+        T &operator()(size_t i, size_t j) {
+            return m[i][j];
+        }
+
+        T get(size_t i, size_t j) const {
+            return m[i][j];
+        }
+
+        VectorType translation() const {
+            return VectorType({m[0][3], m[1][3], m[2][3]});
+        }
+
+        ///@return The full 4x4 matrix, with the bottom row (0, 0, 0, 1).
+        Matrix<T, 4, 4> matrix() const {
+            Matrix<T, 4, 4> result;
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    result[i][j] = m[i][j];
+                }
+            }
+            result[3][0] = result[3][1] = result[3][2] = 0;
+            result[3][3] = 1;
+            return result;
+        }
+
+        ///@return The transform which applies @param b, then this one.
+        Affine3 operator*(const Affine3 &b) const {
+            Affine3 result = Affine3(_Uninitialized());
+            _mulAffine3(&m[0][0], &b.m[0][0], &result.m[0][0]);
+            return result;
+        }
+
+        Affine3 &operator*=(const Affine3 &b) {
+            return (*this = *this * b);
+        }
+
+        ///@return @param p transformed as a point: A p + t.
+        VectorType apply(const VectorType &p) const {
+            VectorType result;
+            for (size_t i = 0; i < 3; ++i) {
+                result[i] = m[i][0] * p[0] + m[i][1] * p[1] + m[i][2] * p[2] + m[i][3];
+            }
+            return result;
+        }
+
+        ///@return @param d transformed as a direction, without the translation: A d.
+        VectorType applyDirection(const VectorType &d) const {
+            VectorType result;
+            for (size_t i = 0; i < 3; ++i) {
+                result[i] = m[i][0] * d[0] + m[i][1] * d[1] + m[i][2] * d[2];
+            }
+            return result;
+        }
+
+        ///@return The homogeneous vector @param v transformed, as by the 4x4 matrix: its w is kept and scales the translation.
+        Vector<T, 4> operator*(const Vector<T, 4> &v) const {
+            Vector<T, 4> result;
+            for (size_t i = 0; i < 3; ++i) {
+                result[i] = m[i][0] * v[0] + m[i][1] * v[1] + m[i][2] * v[2] + m[i][3] * v[3];
+            }
+            result[3] = v[3];
+            return result;
+        }
+
+        ///@return The transform which applies this one after a translation by @param t, in 9 multiplications.
+        Affine3 translated(const VectorType &t) const {
+            Affine3 result = *this;
+            for (size_t i = 0; i < 3; ++i) {
+                result.m[i][3] += m[i][0] * t[0] + m[i][1] * t[1] + m[i][2] * t[2];
+            }
+            return result;
+        }
+
+        T determinant() const {
+            return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                 - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+                 + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+        }
+
+        ///@return The inverse, | A^-1 -A^-1 t |. The linear part must be invertible.
+        Affine3 inverse() const {
+            Affine3 result;
+            T k = 1 / determinant();
+            result.m[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * k;
+            result.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * k;
+            result.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * k;
+            result.m[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * k;
+            result.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * k;
+            result.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * k;
+            result.m[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * k;
+            result.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * k;
+            result.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * k;
+            for (size_t i = 0; i < 3; ++i) {
+                result.m[i][3] = -(result.m[i][0] * m[0][3] + result.m[i][1] * m[1][3] + result.m[i][2] * m[2][3]);
+            }
+            return result;
+        }
+
+    private:
+
+        struct _Uninitialized {};
+
+        ///@brief Constructor which leaves the elements unset, for results which are written in full.
+        explicit Affine3(_Uninitialized) {}
+
+        T m[3][4];
+    };
+
+    ///typedefs
+    typedef Affine3<float> Affine3f;
+    typedef Affine3<double> Affine3d;
+    typedef Affine3<Real> AffineTransformation;
+}
+
+#endif // JML_AFFINE_H
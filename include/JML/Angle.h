@@ -11,6 +11,8 @@
 @section    DESCRIPTION
 Implements an Angle class designed to mimic the behaviour of mathematical angles.
 
+An Angle can also hold its (cos, sin) pair, the angle as a unit complex number. The pair is set by cacheVector(), by construction from a vector, and by sums and differences of angles which both hold one, which are then complex products rather than trigonometric evaluations.
+
 */
 
 #include <JML/Vector.hpp>
@@ -34,7 +36,7 @@ namespace jml {
 
     */
 
-    using AngularVector = Vector<long double, 2>;
+    using AngularVector = Vector<Real, 2>;
 
     public:
 
@@ -51,38 +53,62 @@ namespace jml {
             DEGREES
         };
 
-        Angle() : raw(0.0L), sm(0) {}
+        Angle() : raw(0), sm(0), unit(false), cosine(0), sine(0) {}
 
-        Angle(long double r) : raw(r), sm(0) {}
+        Angle(Real r) : raw(r), sm(0), unit(false), cosine(0), sine(0) {}
 
-        Angle(const Angle &a) : raw(static_cast<long double>(a)), sm(a.sm) {}
+        Angle(const Angle &a) : raw(static_cast<Real>(a)), sm(a.sm), unit(a.unit), cosine(a.cosine), sine(a.sine) {}
 
-        Angle(Angle &&a) : raw(static_cast<long double>(a)), sm(a.sm) {
+        Angle(Angle &&a) : raw(static_cast<Real>(a)), sm(a.sm), unit(a.unit), cosine(a.cosine), sine(a.sine) {
             a.raw = 0;
             a.sm = 0;
+            a.unit = false;
         }
 
-        Angle(AngularVector v) : sm(0) {
-            setVector(v);
+        ///@brief Constructor which takes the angle of @param v, by atan2 in the mode @param m.
+        Angle(AngularVector v, uint8_t m = JML_ATAN2_EXACT) : raw(0), sm(0), unit(false), cosine(0), sine(0) {
+            setVector(v, m);
         }
 
-        Angle &setRadians(long double r) {
+        Angle &setRadians(Real r) {
             raw = r;
+            unit = false;
+            return *this;
+        }
+
+        Angle &setDegrees(Real d) {
+            raw = d * pi() / 180;
+            unit = false;
             return *this;
         }
 
-        Angle &setDegrees(long double d) {
-            raw = d * JML_PI/ 180.0L;
+        ///@brief Sets the angle to that of @param v by atan2 in the mode @param m, and caches the direction of @param v as its (cos, sin) pair.
+        Angle &setVector(AngularVector v, uint8_t m = JML_ATAN2_EXACT) {
+            raw = atan2(v.y(), v.x(), m);
+            Real l = v.magnitude();
+            unit = false;
+            if (l > 0) {
+                setUnit(v.x() / l, v.y() / l);
+            }
             return *this;
         }
 
-        Angle &setVector(AngularVector v) {
-            raw = atan2(v.y(), v.x());
+        ///@brief Computes and caches the (cos, sin) pair of the angle.
+        Angle &cacheVector() {
+            if (!unit) {
+                jml::sincos(raw, sine, cosine);
+                unit = true;
+            }
             return *this;
         }
 
+        ///@return [true]: The angle holds its (cos, sin) pair, so vector(), cos() and sin() need no trigonometry.
+        bool cached() const {
+            return unit;
+        }
+
         auto getType() const -> Type {
-            long double degs = abs(degrees(*this));
+            Real degs = abs(degrees(*this));
             while (compare(degs, 360.0L) == JML_GREATER) {
                 degs -= 360.0L;
             }
@@ -100,26 +126,34 @@ namespace jml {
         }
 
         Angle bisector() const {
-            return Angle(raw / 2.0L);
+            return Angle(raw / 2);
         }
 
         Angle inverse() const {
-            long double r = abs(raw * 3.0L);
+            Real r = abs(raw * 3);
             while (compare(r, radians(360_degs)) == JML_GREATER) {
                 r -= radians(360_degs);
             }
             return Angle(r);
         }
 
-        explicit operator long double() const {
+        explicit operator Real() const {
             return raw;
         }
 
         Angle operator+(const Angle &b) const {
-            return Angle(radians(*this) + radians(b));
+            Angle r(radians(*this) + radians(b));
+            if (unit && b.unit) {
+                r.setUnit(cosine * b.cosine - sine * b.sine, sine * b.cosine + cosine * b.sine);
+            }
+            return r;
         }
         Angle operator-(const Angle &b) const {
-            return Angle(radians(*this) - radians(b));
+            Angle r(radians(*this) - radians(b));
+            if (unit && b.unit) {
+                r.setUnit(cosine * b.cosine + sine * b.sine, sine * b.cosine - cosine * b.sine);
+            }
+            return r;
         }
         Angle operator*(const Angle &b) const {
             return Angle(radians(*this) * radians(b));
@@ -165,29 +199,55 @@ namespace jml {
         }
 
         Angle &operator=(const Angle &a) {
-            raw = static_cast<long double>(a);
+            raw = static_cast<Real>(a);
             sm = a.sm;
+            unit = a.unit;
+            cosine = a.cosine;
+            sine = a.sine;
             return *this;
         }
 
         Angle &operator=(Angle &&a) {
-            raw = static_cast<long double>(a);
+            raw = static_cast<Real>(a);
             sm = a.sm;
+            unit = a.unit;
+            cosine = a.cosine;
+            sine = a.sine;
             a.raw = 0;
             a.sm = 0;
+            a.unit = false;
             return *this;
         }
 
-        static long double radians(const Angle &a) {
-            return static_cast<long double>(a);
+        static Real radians(const Angle &a) {
+            return static_cast<Real>(a);
         }
 
-        static long double degrees(const Angle &a) {
-            return radians(a) * 180.0L / JML_PI;
+        static Real degrees(const Angle &a) {
+            return radians(a) * 180 / pi();
         }
 
         static auto vector(const Angle &a) -> AngularVector {
-            return AngularVector({cos(static_cast<long double>(a)), sin(static_cast<long double>(a))});
+            Real s, c;
+            sincos(a, s, c);
+            return AngularVector({c, s});
+        }
+
+        ///@return pseudoAngle() of the direction of @param a, which orders angles in (-pi, pi] like their radians. Needs no trigonometry if @param a holds its (cos, sin) pair.
+        static Real pseudo(const Angle &a) {
+            Real s, c;
+            sincos(a, s, c);
+            return pseudoAngle(s, c);
+        }
+
+        ///@brief Writes sin @param a to @param s and cos @param a to @param c, from the cached pair if @param a holds one.
+        static void sincos(const Angle &a, Real &s, Real &c) {
+            if (a.unit) {
+                s = a.sine;
+                c = a.cosine;
+            } else {
+                jml::sincos(static_cast<Real>(a), s, c);
+            }
         }
 
         Angle &stringMode(uint8_t m) {
@@ -211,7 +271,11 @@ namespace jml {
         }
 
         Angle operator-() const {
-            return Angle(raw * -1);
+            Angle r(raw * -1);
+            if (unit) {
+                r.setUnit(cosine, -sine);
+            }
+            return r;
         }
 
         ~Angle() {
@@ -221,84 +285,131 @@ namespace jml {
 
 
     private:
-        long double raw;
+        Real raw;
         uint8_t sm;
+        bool unit;
+        Real cosine, sine;
+
+        ///Caches the pair ( @param c, @param s ), scaled back onto the unit circle by one Newton step so that chains of sums do not drift.
+        void setUnit(Real c, Real s) {
+            Real k = (3 - (c * c + s * s)) / 2;
+            cosine = c * k;
+            sine = s * k;
+            unit = true;
+        }
     };
 
-    inline long double cos(const Angle &a) {
-        return cos(Angle::radians(a));
+    inline Real cos(const Angle &a) {
+        if (!a.cached()) {
+            return cos(Angle::radians(a));
+        }
+        Real s, c;
+        Angle::sincos(a, s, c);
+        return c;
+    }
+
+    inline Real sin(const Angle &a) {
+        if (!a.cached()) {
+            return sin(Angle::radians(a));
+        }
+        Real s, c;
+        Angle::sincos(a, s, c);
+        return s;
     }
 
-    inline long double sin(const Angle &a) {
-        return sin(Angle::radians(a));
+    inline void sincos(const Angle &a, Real &s, Real &c) {
+        Angle::sincos(a, s, c);
+    }
+
+    ///@return sin @param a by the trigonometry policy P, or from the cached pair if @param a holds one.
+    template <typename P>
+    inline Real sin(const Angle &a) {
+        return (a.cached()? sin(a) : P::sin(Angle::radians(a)));
+    }
+
+    ///@return cos @param a by the trigonometry policy P, or from the cached pair if @param a holds one.
+    template <typename P>
+    inline Real cos(const Angle &a) {
+        return (a.cached()? cos(a) : P::cos(Angle::radians(a)));
+    }
+
+    template <typename P>
+    inline void sincos(const Angle &a, Real &s, Real &c) {
+        if (a.cached()) {
+            Angle::sincos(a, s, c);
+        } else {
+            P::sincos(Angle::radians(a), s, c);
+        }
     }
 
-    inline long double asin(const Angle &a) {
+    inline Real asin(const Angle &a) {
         return asin(Angle::radians(a));
     }
 
-    inline long double acos(const Angle &a) {
+    inline Real acos(const Angle &a) {
         return acos(Angle::radians(a));
     }
 
-    inline long double atan(const Angle &a) {
+    inline Real atan(const Angle &a) {
         return atan(Angle::radians(a));
     }
 
-    inline long double tan(const Angle &a) {
-        return tan(Angle::radians(a));
+    inline Real tan(const Angle &a) {
+        Real s, c;
+        Angle::sincos(a, s, c);
+        return s / c;
     }
 
-    inline long double cot(const Angle &a) {
+    inline Real cot(const Angle &a) {
         return cot(Angle::radians(a));
     }
 
-    inline long double acot(const Angle &a) {
+    inline Real acot(const Angle &a) {
         return acot(Angle::radians(a));
     }
 
-    inline long double sec(const Angle &a) {
+    inline Real sec(const Angle &a) {
         return sec(Angle::radians(a));
     }
 
-    inline long double asec(const Angle &a) {
+    inline Real asec(const Angle &a) {
         return asec(Angle::radians(a));
     }
 
-    inline long double csc(const Angle &a) {
+    inline Real csc(const Angle &a) {
         return csc(Angle::radians(a));
     }
 
-    inline long double acsc(const Angle &a) {
+    inline Real acsc(const Angle &a) {
         return acsc(Angle::radians(a));
     }
 
-    inline long double sigmoid(const Angle &a) {
+    inline Real sigmoid(const Angle &a) {
         return sigmoid(Angle::radians(a));
     }
 
-    inline long double tanh(const Angle &a) {
+    inline Real tanh(const Angle &a) {
         return tanh(Angle::radians(a));
     }
 
     inline Angle literals::operator "" _degs(long double l) {
-        long double rads = l * pi() / 180.0L;
+        Real rads = static_cast<Real>(l) * pi() / 180;
         Angle a(rads);
         a.stringMode(Angle::DEGREES);
         return a;
     }
     inline Angle literals::operator "" _rads(long double l) {
-        return Angle(l);
+        return Angle(static_cast<Real>(l));
     }
 
     inline Angle literals::operator "" _degs(unsigned long long l) {
-        long double rads = static_cast<long double>(l) * pi() / 180.0L;
+        Real rads = static_cast<Real>(l) * pi() / 180;
         Angle a(rads);
         a.stringMode(Angle::DEGREES);
         return a;
     }
     inline Angle literals::operator "" _rads(unsigned long long l) {
-        return Angle(static_cast<double>(l));
+        return Angle(static_cast<Real>(l));
     }
 }
 
@@ -0,0 +1,439 @@
+#ifndef JML_BVH_H
+#define JML_BVH_H
+
+/**
+
+@file       BVH.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements a bounding volume hierarchy over 2D segments, which answers ray queries in time logarithmic in the number of segments.
+
+The tree is built top down with the surface area heuristic, binned over the segments' centroids, and stored as a flat array of nodes
+in depth-first order: the left child of a node directly follows it and the right child is stored by index. The segments are copied
+in leaf order, so that a leaf's segments are contiguous in memory.
+
+After segments move, refit() recomputes the boxes bottom up in one pass over the nodes, keeping the topology. That is much cheaper
+than build(), but the tree degrades as the segments drift from where they were when it was built.
+
+closestHit() finds the nearest segment along a ray, visiting the nearer child first and skipping boxes beyond the nearest hit so far.
+anyHit() stops at the first segment found, for occlusion and visibility tests. Both take arrays of rays too, which are traversed in
+packets of JML_BVH_PACKET: each node is fetched and tested once for the whole packet, which pays off when the rays are coherent,
+such as those cast from one point over a narrow fan.
+
+Hits are found with the parametric ray-segment test in T. A ray which runs along a segment does not hit it.
+
+*/
+
+#include <JML/Primitives.h>
+#include <JML/sorting.h>
+
+#define JML_BVH_LEAF    4
+#define JML_BVH_BINS    16
+#define JML_BVH_DEPTH   48
+#define JML_BVH_PACKET  8
+#define JML_BVH_MISS    static_cast<size_t>(-1)
+
+namespace jml {
+
+    /**
+
+    @brief Bounding volume hierarchy over 2D segments.
+    @param T: Scalar type of the coordinates, float or double.
+
+    */
+
+    template <typename T>
+    class BVH {
+    public:
+
+        typedef Segment2<T> SegmentType;
+        typedef Ray2<T> RayType;
+
+        ///Result of a ray query: the index of the segment hit, or JML_BVH_MISS, and the ray parameter of the hit.
+        struct Hit {
+            size_t segment;
+            T t;
+        };
+
+        BVH() {}
+
+        ///@brief Builds the hierarchy over the LineSegments or Segment2s [ @param begin, @param end ).
+        template <typename I>
+        BVH(I begin, I end) {
+            for (I i = begin; i != end; ++i) {
+                segments.insert(SegmentType(*i));
+            }
+            build();
+        }
+
+        size_t size() const {
+            return segments.size();
+        }
+
+        ///@return The segment of index @param i, in the order given at construction.
+        const SegmentType &segment(size_t i) const {
+            return segments[positions[i]];
+        }
+
+        ///@brief Moves the segment of index @param i to @param s. Takes effect on queries after refit() or build().
+        void set(size_t i, const SegmentType &s) {
+            segments[positions[i]] = s;
+        }
+
+        ///@brief Rebuilds the hierarchy over the current segments.
+        void build() {
+            size_t n = segments.size();
+            jutil::Queue<SegmentType> source = segments;
+            jutil::Queue<size_t> ids = indices;
+            nodes.clear();
+            permutation.clear();
+            centroids.clear();
+            for (size_t i = 0; i < n; ++i) {
+                permutation.insert(i);
+                centroids.insert(source[i].a + source[i].b);
+                if (ids.size() < n) {
+                    ids.insert(i);
+                }
+            }
+            if (n) {
+                buildNode(source, 0, n, 0);
+            }
+            indices.resize(n);
+            positions.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                segments[i] = source[permutation[i]];
+                indices[i] = ids[permutation[i]];
+                positions[indices[i]] = i;
+            }
+            permutation.clear();
+            centroids.clear();
+        }
+
+        ///@brief Recomputes the boxes of every node around the current segments, keeping the tree's topology.
+        void refit() {
+            for (size_t i = nodes.size(); i-- > 0;) {
+                Node &node = nodes[i];
+                if (node.count) {
+                    node.box = boxOf(node.index, node.index + node.count);
+                } else {
+                    node.box = nodes[i + 1].box;
+                    node.box.grow(nodes[node.index].box);
+                }
+            }
+        }
+
+        /**
+
+        @brief Finds the nearest segment hit by @param r with a ray parameter in [ @param tMin, @param tMax ].
+        The ray parameter t is that of r.at(t), so 1 is the point r.through.
+        @return Whether a segment was hit. @param h holds the hit, or JML_BVH_MISS.
+
+        */
+
+        bool closestHit(const RayType &r, Hit &h, T tMin = 0, T tMax = _maxValue<T>()) const {
+            _Lane lane(r, tMin, tMax);
+            traverse<false>(&lane, 1);
+            h = lane.hit;
+            return h.segment != JML_BVH_MISS;
+        }
+
+        ///@return Whether @param r hits any segment with a ray parameter in [ @param tMin, @param tMax ].
+        bool anyHit(const RayType &r, T tMin = 0, T tMax = _maxValue<T>()) const {
+            _Lane lane(r, tMin, tMax);
+            traverse<true>(&lane, 1);
+            return lane.hit.segment != JML_BVH_MISS;
+        }
+
+        ///@return Whether any segment crosses the segment @param s, as for a line of sight.
+        bool anyHit(const SegmentType &s) const {
+            return anyHit(RayType(s.a, s.b), 0, 1);
+        }
+
+        ///@brief Finds the nearest hits of the @param n rays @param r, in packets, writing them to @param h.
+        void closestHit(const RayType *r, size_t n, Hit *h, T tMin = 0, T tMax = _maxValue<T>()) const {
+            for (size_t b = 0; b < n; b += JML_BVH_PACKET) {
+                size_t m = (n - b < JML_BVH_PACKET? n - b : JML_BVH_PACKET);
+                _Lane lanes[JML_BVH_PACKET];
+                for (size_t k = 0; k < m; ++k) {
+                    lanes[k] = _Lane(r[b + k], tMin, tMax);
+                }
+                traverse<false>(lanes, m);
+                for (size_t k = 0; k < m; ++k) {
+                    h[b + k] = lanes[k].hit;
+                }
+            }
+        }
+
+        ///@brief Writes whether each of the @param n rays @param r hits any segment to @param hit, testing them in packets.
+        void anyHit(const RayType *r, size_t n, bool *hit, T tMin = 0, T tMax = _maxValue<T>()) const {
+            for (size_t b = 0; b < n; b += JML_BVH_PACKET) {
+                size_t m = (n - b < JML_BVH_PACKET? n - b : JML_BVH_PACKET);
+                _Lane lanes[JML_BVH_PACKET];
+                for (size_t k = 0; k < m; ++k) {
+                    lanes[k] = _Lane(r[b + k], tMin, tMax);
+                }
+                traverse<true>(lanes, m);
+                for (size_t k = 0; k < m; ++k) {
+                    hit[b + k] = lanes[k].hit.segment != JML_BVH_MISS;
+                }
+            }
+        }
+
+    private:
+
+        struct Box {
+            T lo[2], hi[2];
+
+            static Box empty() {
+                Box b;
+                b.lo[0] = b.lo[1] = _maxValue<T>();
+                b.hi[0] = b.hi[1] = -_maxValue<T>();
+                return b;
+            }
+
+            void grow(const Box &b) {
+                for (size_t i = 0; i < 2; ++i) {
+                    lo[i] = (b.lo[i] < lo[i]? b.lo[i] : lo[i]);
+                    hi[i] = (b.hi[i] > hi[i]? b.hi[i] : hi[i]);
+                }
+            }
+
+            void grow(const Vector<T, 2> &p) {
+                for (size_t i = 0; i < 2; ++i) {
+                    lo[i] = (p[i] < lo[i]? p[i] : lo[i]);
+                    hi[i] = (p[i] > hi[i]? p[i] : hi[i]);
+                }
+            }
+
+            ///@return Half the perimeter, which stands in for the surface area of the heuristic in 2D.
+            T area() const {
+                return (hi[0] < lo[0]? 0 : (hi[0] - lo[0]) + (hi[1] - lo[1]));
+            }
+        };
+
+        ///Node of the tree. Leaves hold count > 0 segments from index on; interior nodes hold count = 0 and their right child at index.
+        struct Node {
+            Box box;
+            uint32_t index, count;
+        };
+
+        ///A ray being traversed, with its reciprocal direction for the slab test.
+        struct _Lane {
+            T o[2], d[2], inv[2], tMin, tMax;
+            Hit hit;
+
+            _Lane() {}
+            _Lane(const RayType &r, T t0, T t1) : tMin(t0), tMax(t1) {
+                for (size_t i = 0; i < 2; ++i) {
+                    o[i] = r.origin[i];
+                    d[i] = r.through[i] - r.origin[i];
+                    inv[i] = static_cast<T>(1) / d[i];
+                }
+                hit.segment = JML_BVH_MISS;
+                hit.t = t1;
+            }
+
+            ///@return Whether the ray enters @param b between tMin and the nearest hit so far.
+            bool enters(const Box &b) const {
+                T t0 = tMin, t1 = tMax;
+                for (size_t i = 0; i < 2; ++i) {
+                    T near = (b.lo[i] - o[i]) * inv[i], far = (b.hi[i] - o[i]) * inv[i];
+                    if (near > far) {
+                        T t = near;
+                        near = far;
+                        far = t;
+                    }
+                    t0 = (near > t0? near : t0);
+                    t1 = (far < t1? far : t1);
+                }
+                return t0 <= t1;
+            }
+
+            ///@brief Records @param s, of position @param i, if the ray hits it nearer than the nearest hit so far.
+            bool test(const SegmentType &s, size_t i) {
+                T ex = s.b[0] - s.a[0], ey = s.b[1] - s.a[1];
+                T den = d[0] * ey - d[1] * ex;
+                if (den == 0) return false;
+                T wx = s.a[0] - o[0], wy = s.a[1] - o[1];
+                T t = (wx * ey - wy * ex) / den, u = (wx * d[1] - wy * d[0]) / den;
+                if (t < tMin || t > tMax || u < 0 || u > 1) return false;
+                tMax = t;
+                hit.segment = i;
+                hit.t = t;
+                return true;
+            }
+        };
+
+        jutil::Queue<SegmentType> segments;
+        jutil::Queue<Node> nodes;
+        ///The index given at construction of the segment at each position, and the inverse.
+        jutil::Queue<size_t> indices, positions;
+        ///Positions of the segments being built, in leaf order, and their centroids, doubled.
+        jutil::Queue<size_t> permutation;
+        jutil::Queue<Vector<T, 2> > centroids;
+
+        Box boxOf(size_t b, size_t e) const {
+            Box box = Box::empty();
+            for (size_t i = b; i < e; ++i) {
+                box.grow(segments[i].a);
+                box.grow(segments[i].b);
+            }
+            return box;
+        }
+
+        ///@brief Builds the subtree over the segments permutation[ @param b, @param e ) of @param source at depth @param depth.
+        size_t buildNode(const jutil::Queue<SegmentType> &source, size_t b, size_t e, size_t depth) {
+            size_t index = nodes.size();
+            nodes.insert(Node());
+            Box box = Box::empty(), bounds = Box::empty();
+            for (size_t i = b; i < e; ++i) {
+                box.grow(source[permutation[i]].a);
+                box.grow(source[permutation[i]].b);
+                bounds.grow(centroids[permutation[i]]);
+            }
+            size_t n = e - b, axis = (bounds.hi[1] - bounds.lo[1] > bounds.hi[0] - bounds.lo[0]? 1 : 0);
+            T extent = bounds.hi[axis] - bounds.lo[axis];
+            if (n <= JML_BVH_LEAF) {
+                return leaf(index, box, b, e);
+            }
+
+            size_t m = b;
+            if (depth < JML_BVH_DEPTH && extent > 0) {
+                //Bins the centroids and takes the split of least cost, area times count, on either side.
+                Box bins[JML_BVH_BINS];
+                size_t counts[JML_BVH_BINS] = {0};
+                for (size_t i = 0; i < JML_BVH_BINS; ++i) {
+                    bins[i] = Box::empty();
+                }
+                T scale = JML_BVH_BINS / extent;
+                for (size_t i = b; i < e; ++i) {
+                    size_t k = bin(centroids[permutation[i]][axis], bounds.lo[axis], scale);
+                    ++counts[k];
+                    bins[k].grow(source[permutation[i]].a);
+                    bins[k].grow(source[permutation[i]].b);
+                }
+                T right[JML_BVH_BINS];
+                Box acc = Box::empty();
+                size_t count = 0;
+                for (size_t i = JML_BVH_BINS - 1; i > 0; --i) {
+                    acc.grow(bins[i]);
+                    count += counts[i];
+                    right[i] = acc.area() * count;
+                }
+                acc = Box::empty();
+                count = 0;
+                T best = box.area() * n;
+                size_t split = 0;
+                for (size_t i = 0; i + 1 < JML_BVH_BINS; ++i) {
+                    acc.grow(bins[i]);
+                    count += counts[i];
+                    T cost = acc.area() * count + right[i + 1];
+                    if (count && count < n && cost < best) {
+                        best = cost;
+                        split = i + 1;
+                    }
+                }
+                if (!split) {
+                    return leaf(index, box, b, e);
+                }
+                T lo = bounds.lo[axis];
+                const jutil::Queue<Vector<T, 2> > &c = centroids;
+                m = _partition(permutation.begin() + b, permutation.begin() + e, [&](size_t i) {
+                    return bin(c[i][axis], lo, scale) < split;
+                }) - permutation.begin();
+            }
+            if (m == b || m == e) {
+                //Past the depth limit, or where binning fails, splits at the median, which bounds the depth at log n.
+                m = (b + e) / 2;
+                const jutil::Queue<Vector<T, 2> > &c = centroids;
+                _nthElement(permutation.begin() + b, permutation.begin() + m, permutation.begin() + e, [&](size_t i, size_t j) {
+                    return c[i][axis] < c[j][axis];
+                });
+            }
+            buildNode(source, b, m, depth + 1);
+            size_t r = buildNode(source, m, e, depth + 1);
+            nodes[index].box = box;
+            nodes[index].index = static_cast<uint32_t>(r);
+            nodes[index].count = 0;
+            return index;
+        }
+
+        size_t leaf(size_t index, const Box &box, size_t b, size_t e) {
+            nodes[index].box = box;
+            nodes[index].index = static_cast<uint32_t>(b);
+            nodes[index].count = static_cast<uint32_t>(e - b);
+            return index;
+        }
+
+        static size_t bin(T c, T lo, T scale) {
+            size_t k = static_cast<size_t>((c - lo) * scale);
+            return (k < JML_BVH_BINS? k : JML_BVH_BINS - 1);
+        }
+
+        /**
+
+        @brief Traverses the tree once for the @param n rays @param lanes together.
+        A node is entered when any ray of the packet enters its box before its nearest hit so far. Children are visited
+        nearer first by the direction of the first ray, which suits coherent packets.
+        @param any: Whether each ray stops at its first hit.
+
+        */
+
+        template <bool any>
+        void traverse(_Lane *lanes, size_t n) const {
+            if (nodes.size() == 0) return;
+            uint32_t stack[JML_BVH_DEPTH + 64];
+            size_t top = 0;
+            uint32_t i = 0;
+            bool done[JML_BVH_PACKET] = {false};
+            size_t active = n;
+            for (;;) {
+                const Node &node = nodes[i];
+                bool enter = false;
+                for (size_t k = 0; k < n; ++k) {
+                    if (!done[k] && lanes[k].enters(node.box)) {
+                        enter = true;
+                    }
+                }
+                if (enter) {
+                    if (node.count) {
+                        for (size_t s = node.index; s < node.index + node.count; ++s) {
+                            for (size_t k = 0; k < n; ++k) {
+                                if (!done[k] && lanes[k].test(segments[s], s) && any) {
+                                    done[k] = true;
+                                    --active;
+                                }
+                            }
+                        }
+                        if (any && !active) break;
+                    } else {
+                        //Takes the near child first, by the sign of the first ray along the axis where the children are further apart.
+                        const Box &l = nodes[i + 1].box, &r = nodes[node.index].box;
+                        T dx = (r.lo[0] + r.hi[0]) - (l.lo[0] + l.hi[0]), dy = (r.lo[1] + r.hi[1]) - (l.lo[1] + l.hi[1]);
+                        size_t axis = ((dy < 0? -dy : dy) > (dx < 0? -dx : dx)? 1 : 0);
+                        bool leftFirst = ((axis? dy : dx) > 0) == (lanes[0].d[axis] >= 0);
+                        stack[top++] = (leftFirst? node.index : i + 1);
+                        i = (leftFirst? i + 1 : node.index);
+                        continue;
+                    }
+                }
+                if (!top) break;
+                i = stack[--top];
+            }
+            for (size_t k = 0; k < n; ++k) {
+                if (lanes[k].hit.segment != JML_BVH_MISS) {
+                    lanes[k].hit.segment = indices[lanes[k].hit.segment];
+                }
+            }
+        }
+    };
+
+    ///typedefs
+    typedef BVH<float> BVHf;
+    typedef BVH<double> BVHd;
+}
+
+#endif // JML_BVH_H
@@ -0,0 +1,413 @@
+#ifndef JML_EXPRESSION_H
+#define JML_EXPRESSION_H
+
+/**
+
+@file       Expression.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements lazily evaluated, element-wise arithmetic on vectors and matrices.
+
+Arithmetic operators return lightweight expression objects instead of computing a result. An expression is only evaluated when it is
+assigned to (or used to construct) a Vector or Matrix, at which point the whole expression runs as a single loop, with no temporaries.
+
+@warning Expressions refer to the vectors and matrices they were built from. Store results in a Vector or Matrix, not in an auto variable.
+
+*/
+
+#include <JML/declarations.h>
+
+namespace jml {
+
+    /**
+
+    @brief CRTP base of every vector-like object.
+    Derived types must provide @c type, @c nLength and @c get(size_t).
+
+    */
+
+    template <typename E>
+    class VectorExpression {
+    public:
+
+        const E &self() const {
+            return static_cast<const E&>(*this);
+        }
+
+        ///@return The expression evaluated into a Vector.
+        template <typename F = E>
+        auto eval() const -> Vector<typename F::type, F::nLength> {
+            return Vector<typename F::type, F::nLength>(self());
+        }
+
+        ///@return The sum of the squares of the elements, ||*this||^2.
+        Real magnitudeSquared() const {
+            Real r = 0;
+            for (size_t i = 0; i < E::nLength; ++i) {
+                Real v = static_cast<Real>(self().get(i));
+                r += v * v;
+            }
+            return r;
+        }
+
+        ///@return ||*this||, with the square root taken in the mode @param m.
+        Real magnitude(uint8_t m = JML_SQRT_EXACT) const {
+            return sqrt(magnitudeSquared(), m);
+        }
+
+        ///@return *this / ||*this||, with the reciprocal square root taken in the mode @param m.
+        template <typename F = E>
+        auto unitForm(uint8_t m = JML_SQRT_EXACT) const -> Vector<Real, F::nLength> {
+            Vector<Real, F::nLength> v;
+            Real s = rsqrt(magnitudeSquared(), m);
+            for (size_t i = 0; i < F::nLength; ++i) {
+                v[i] = static_cast<Real>(self().get(i)) * s;
+            }
+            return v;
+        }
+    };
+
+    /**
+
+    @brief CRTP base of every matrix-like object.
+    Derived types must provide @c ValueType, @c nRows, @c nCols and @c get(size_t, size_t).
+
+    */
+
+    template <typename E>
+    class MatrixExpression {
+    public:
+
+        const E &self() const {
+            return static_cast<const E&>(*this);
+        }
+
+        ///@return The expression evaluated into a Matrix.
+        template <typename F = E>
+        auto eval() const -> Matrix<typename F::ValueType, F::nRows, F::nCols> {
+            return Matrix<typename F::ValueType, F::nRows, F::nCols>(self());
+        }
+    };
+
+    /**
+
+    @brief How an operand is held inside an expression. Vectors and matrices are held by reference, everything else by value.
+
+    */
+
+    template <typename E>
+    struct _Nested {
+        typedef const E Type;
+    };
+
+    template <typename T, size_t length, typename X>
+    struct _Nested<Vector<T, length, X> > {
+        typedef const Vector<T, length, X> &Type;
+    };
+
+    template <typename T, size_t rows, size_t cols, typename L, typename X>
+    struct _Nested<Matrix<T, rows, cols, L, X> > {
+        typedef const Matrix<T, rows, cols, L, X> &Type;
+    };
+
+    ///Element-wise operations.
+    struct _Add {
+        template <typename A, typename B>
+        struct Result {
+            typedef ADD_T(A, B) Type;
+        };
+        template <typename R, typename A, typename B>
+        static R apply(const A &a, const B &b) {
+            return static_cast<R>(a) + static_cast<R>(b);
+        }
+    };
+
+    struct _Subtract {
+        template <typename A, typename B>
+        struct Result {
+            typedef SUBTRACT_T(A, B) Type;
+        };
+        template <typename R, typename A, typename B>
+        static R apply(const A &a, const B &b) {
+            return static_cast<R>(a) - static_cast<R>(b);
+        }
+    };
+
+    struct _Multiply {
+        template <typename A, typename B>
+        struct Result {
+            typedef MULTIPLY_T(A, B) Type;
+        };
+        template <typename R, typename A, typename B>
+        static R apply(const A &a, const B &b) {
+            return static_cast<R>(a) * static_cast<R>(b);
+        }
+    };
+
+    struct _Divide {
+        template <typename A, typename B>
+        struct Result {
+            typedef DIVIDE_T(A, B) Type;
+        };
+        template <typename R, typename A, typename B>
+        static R apply(const A &a, const B &b) {
+            return static_cast<R>(a) / static_cast<R>(b);
+        }
+    };
+
+    /**
+
+    @brief Element-wise combination of two vector expressions.
+
+    */
+
+    template <typename Op, typename L, typename R>
+    class VectorBinary : public VectorExpression<VectorBinary<Op, L, R> > {
+    public:
+
+        static constexpr size_t nLength = L::nLength;
+
+        typedef typename Op::template Result<typename L::type, typename R::type>::Type type;
+
+        VectorBinary(const L &a, const R &b) : l(a), r(b) {}
+
+        type get(size_t i) const {
+            return Op::template apply<type>(l.get(i), r.get(i));
+        }
+
+        type operator[](size_t i) const {
+            return get(i);
+        }
+
+    private:
+        typename _Nested<L>::Type l;
+        typename _Nested<R>::Type r;
+    };
+
+    /**
+
+    @brief Element-wise combination of a vector expression and a scalar.
+
+    */
+
+    template <typename Op, typename L, typename S>
+    class VectorScalar : public VectorExpression<VectorScalar<Op, L, S> > {
+    public:
+
+        static constexpr size_t nLength = L::nLength;
+
+        typedef typename Op::template Result<typename L::type, S>::Type type;
+
+        VectorScalar(const L &a, const S &b) : l(a), s(b) {}
+
+        type get(size_t i) const {
+            return Op::template apply<type>(l.get(i), s);
+        }
+
+        type operator[](size_t i) const {
+            return get(i);
+        }
+
+    private:
+        typename _Nested<L>::Type l;
+        S s;
+    };
+
+    /**
+
+    @brief Element-wise combination of two matrix expressions.
+
+    */
+
+    template <typename Op, typename L, typename R>
+    class MatrixBinary : public MatrixExpression<MatrixBinary<Op, L, R> > {
+    public:
+
+        static constexpr size_t nRows = L::nRows;
+        static constexpr size_t nCols = L::nCols;
+
+        typedef typename Op::template Result<typename L::ValueType, typename R::ValueType>::Type ValueType;
+
+        MatrixBinary(const L &a, const R &b) : l(a), r(b) {}
+
+        ValueType get(size_t x, size_t y) const {
+            return Op::template apply<ValueType>(l.get(x, y), r.get(x, y));
+        }
+
+        constexpr size_t numRows() const {
+            return nRows;
+        }
+
+        constexpr size_t numCols() const {
+            return nCols;
+        }
+
+    private:
+        typename _Nested<L>::Type l;
+        typename _Nested<R>::Type r;
+    };
+
+    /**
+
+    @brief Element-wise combination of a matrix expression and a scalar.
+
+    */
+
+    template <typename Op, typename L, typename S>
+    class MatrixScalar : public MatrixExpression<MatrixScalar<Op, L, S> > {
+    public:
+
+        static constexpr size_t nRows = L::nRows;
+        static constexpr size_t nCols = L::nCols;
+
+        typedef typename Op::template Result<typename L::ValueType, S>::Type ValueType;
+
+        MatrixScalar(const L &a, const S &b) : l(a), s(b) {}
+
+        ValueType get(size_t x, size_t y) const {
+            return Op::template apply<ValueType>(l.get(x, y), s);
+        }
+
+        constexpr size_t numRows() const {
+            return nRows;
+        }
+
+        constexpr size_t numCols() const {
+            return nCols;
+        }
+
+    private:
+        typename _Nested<L>::Type l;
+        S s;
+    };
+
+    /**
+
+    @brief Vector arithmetic. Element-wise operators produce expressions; the product of two vectors is their dot product.
+
+    */
+
+    template <typename L, typename R>
+    inline VectorBinary<_Add, L, R> operator+(const VectorExpression<L> &a, const VectorExpression<R> &b) {
+        static_assert(L::nLength == R::nLength, "Adding vectors of mismatched length.");
+        return VectorBinary<_Add, L, R>(a.self(), b.self());
+    }
+
+    template <typename L, typename R>
+    inline VectorBinary<_Subtract, L, R> operator-(const VectorExpression<L> &a, const VectorExpression<R> &b) {
+        static_assert(L::nLength == R::nLength, "Subtracting vectors of mismatched length.");
+        return VectorBinary<_Subtract, L, R>(a.self(), b.self());
+    }
+
+    template <typename L>
+    inline VectorScalar<_Multiply, L, typename L::type> operator-(const VectorExpression<L> &a) {
+        return VectorScalar<_Multiply, L, typename L::type>(a.self(), static_cast<typename L::type>(-1));
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline VectorScalar<_Multiply, L, U> operator*(const VectorExpression<L> &a, const U &n) {
+        return VectorScalar<_Multiply, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline VectorScalar<_Multiply, L, U> operator*(const U &n, const VectorExpression<L> &a) {
+        return VectorScalar<_Multiply, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline VectorScalar<_Divide, L, U> operator/(const VectorExpression<L> &a, const U &n) {
+        return VectorScalar<_Divide, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename R>
+    inline auto operator*(const VectorExpression<L> &a, const VectorExpression<R> &b) -> MULTIPLY_T(typename L::type, typename R::type) {
+        static_assert(L::nLength == R::nLength, "Multiplying vectors of mismatched length.");
+        typedef MULTIPLY_T(typename L::type, typename R::type) Result;
+        const L &l = a.self();
+        const R &r = b.self();
+        Result result = static_cast<Result>(0);
+        for (size_t i = 0; i < L::nLength; ++i) {
+            result += static_cast<Result>(l.get(i)) * static_cast<Result>(r.get(i));
+        }
+        return result;
+    }
+
+    /**
+
+    @brief Matrix arithmetic. Element-wise operators produce expressions; matrix products are evaluated immediately.
+
+    */
+
+    template <typename L, typename R>
+    inline MatrixBinary<_Add, L, R> operator+(const MatrixExpression<L> &a, const MatrixExpression<R> &b) {
+        static_assert(L::nRows == R::nRows && L::nCols == R::nCols, "Adding matrices of mismatched size.");
+        return MatrixBinary<_Add, L, R>(a.self(), b.self());
+    }
+
+    template <typename L, typename R>
+    inline MatrixBinary<_Subtract, L, R> operator-(const MatrixExpression<L> &a, const MatrixExpression<R> &b) {
+        static_assert(L::nRows == R::nRows && L::nCols == R::nCols, "Subtracting matrices of mismatched size.");
+        return MatrixBinary<_Subtract, L, R>(a.self(), b.self());
+    }
+
+    template <typename L>
+    inline MatrixScalar<_Multiply, L, typename L::ValueType> operator-(const MatrixExpression<L> &a) {
+        return MatrixScalar<_Multiply, L, typename L::ValueType>(a.self(), static_cast<typename L::ValueType>(-1));
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline MatrixScalar<_Multiply, L, U> operator*(const MatrixExpression<L> &a, const U &n) {
+        return MatrixScalar<_Multiply, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline MatrixScalar<_Multiply, L, U> operator*(const U &n, const MatrixExpression<L> &a) {
+        return MatrixScalar<_Multiply, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
+    inline MatrixScalar<_Divide, L, U> operator/(const MatrixExpression<L> &a, const U &n) {
+        return MatrixScalar<_Divide, L, U>(a.self(), n);
+    }
+
+    template <typename L, typename R>
+    inline auto operator*(const MatrixExpression<L> &a, const MatrixExpression<R> &b) -> Matrix<MULTIPLY_T(typename L::ValueType, typename R::ValueType), L::nRows, R::nCols> {
+        static_assert(L::nCols == R::nRows, "Multiplying matrices of incompatible size.");
+        typedef MULTIPLY_T(typename L::ValueType, typename R::ValueType) Result;
+        const L &l = a.self();
+        const R &r = b.self();
+        Matrix<Result, L::nRows, R::nCols> result;
+        for (size_t i = 0; i < L::nRows; ++i) {
+            for (size_t j = 0; j < R::nCols; ++j) {
+                Result sum = static_cast<Result>(0);
+                for (size_t k = 0; k < L::nCols; ++k) {
+                    sum += static_cast<Result>(l.get(i, k)) * static_cast<Result>(r.get(k, j));
+                }
+                result[i][j] = sum;
+            }
+        }
+        return result;
+    }
+
+    template <typename L, typename R>
+    inline auto operator*(const MatrixExpression<L> &a, const VectorExpression<R> &b) -> Vector<MULTIPLY_T(typename L::ValueType, typename R::type), L::nRows> {
+        static_assert(L::nCols == R::nLength, "Multiplying matrix and vector of incompatible size.");
+        typedef MULTIPLY_T(typename L::ValueType, typename R::type) Result;
+        const L &l = a.self();
+        const R &r = b.self();
+        Vector<Result, L::nRows> result;
+        for (size_t i = 0; i < L::nRows; ++i) {
+            Result sum = static_cast<Result>(0);
+            for (size_t j = 0; j < L::nCols; ++j) {
+                sum += static_cast<Result>(l.get(i, j)) * static_cast<Result>(r.get(j));
+            }
+            result[i] = sum;
+        }
+        return result;
+    }
+}
+
+#endif // JML_EXPRESSION_H
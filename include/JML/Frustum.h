@@ -0,0 +1,207 @@
+#ifndef JML_FRUSTUM_H
+#define JML_FRUSTUM_H
+
+/**
+
+@file       Frustum.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements view frustum culling, which drops bounding spheres and boxes that lie wholly outside the view
+before any of their vertices are transformed.
+
+The six planes are extracted from a Transformation, such as perspective() * lookAt(), by Gribb and Hartmann's method:
+a point p is inside exactly when -w <= x, y, z <= w for (x, y, z, w) = M p, and each of those six inequalities is
+the sum or difference of the last row of M and one of the others, dotted with p. The planes are then in the space that M takes
+points from, world space for a view projection, or model space for a full model view projection.
+
+The tests are conservative: an object is reported visible unless it is wholly outside one plane, so objects near the frustum's
+corners may be kept. The batched tests take objects as separate arrays of components, and test them in double lanes,
+4 at a time with AVX and 2 at a time with SSE2. The last partial group is tested by the scalar loop, which evaluates the same sums
+in the same order, so an object's result does not depend on its position in the arrays.
+
+*/
+
+#include <JML/Matrix.h>
+#include <JML/batch.h>
+
+namespace jml {
+
+    class Frustum {
+    public:
+
+        ///@brief Constructor which creates a frustum whose planes are all 0, so that every object is visible.
+        Frustum() {
+            for (size_t i = 0; i < 6; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    planes[i][j] = 0;
+                }
+            }
+        }
+
+        ///@brief Constructor which extracts the planes of the view volume of @param m, which maps points to clip space.
+        explicit Frustum(const Transformation &m) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    planes[2 * i][j] = static_cast<double>(m[3][j] + m[i][j]);
+                    planes[2 * i + 1][j] = static_cast<double>(m[3][j] - m[i][j]);
+                }
+            }
+            for (size_t i = 0; i < 6; ++i) {
+                double k = 1 / _sqrt(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+                for (size_t j = 0; j < 4; ++j) {
+                    planes[i][j] *= k;
+                }
+            }
+        }
+
+        /**
+
+        @return The plane of index @param i: left, right, bottom, top, near and far, in that order.
+        A plane (a, b, c, d) has (a, b, c) of unit length pointing into the frustum, and a point p is on its inner side when a p.x + b p.y + c p.z + d >= 0.
+
+        */
+
+        Vector<double, 4> plane(size_t i) const {
+            return Vector<double, 4>({planes[i][0], planes[i][1], planes[i][2], planes[i][3]});
+        }
+
+        ///@return Whether any of the sphere of centre @param c and radius @param r may be inside the frustum.
+        bool sphere(const Vertex &c, Real r) const {
+            double x = static_cast<double>(c[0]), y = static_cast<double>(c[1]), z = static_cast<double>(c[2]), s = static_cast<double>(r);
+            for (size_t i = 0; i < 6; ++i) {
+                if (distance(i, x, y, z) + s < 0) return false;
+            }
+            return true;
+        }
+
+        ///@return Whether any of the axis-aligned box from @param lo to @param hi may be inside the frustum.
+        bool box(const Vertex &lo, const Vertex &hi) const {
+            for (size_t i = 0; i < 6; ++i) {
+                //The corner furthest along the plane's normal is outside only if the whole box is.
+                double x = static_cast<double>(planes[i][0] >= 0? hi[0] : lo[0]);
+                double y = static_cast<double>(planes[i][1] >= 0? hi[1] : lo[1]);
+                double z = static_cast<double>(planes[i][2] >= 0? hi[2] : lo[2]);
+                if (distance(i, x, y, z) < 0) return false;
+            }
+            return true;
+        }
+
+        /**
+
+        @brief Tests the @param n spheres of centres ( @param x[i], @param y[i], @param z[i] ) and radii @param r[i],
+        writing 1 to @param visible[i] for those which may be inside the frustum and 0 for the rest.
+        @return Number of spheres which may be visible.
+
+        */
+
+        template <typename T>
+        size_t spheres(const T *x, const T *y, const T *z, const T *r, size_t n, uint8_t *visible) const {
+            size_t i = 0, count = 0;
+            #if defined(JML_SSE2)
+            typedef _BatchPack P;
+            P c[6][4];
+            broadcast(c);
+            for (; i + P::Width <= n; i += P::Width) {
+                P px = P::load(x + i), py = P::load(y + i), pz = P::load(z + i), pr = P::load(r + i), zero(0.0), out = zero;
+                for (size_t k = 0; k < 6; ++k) {
+                    P d = ((c[k][0] * px + c[k][1] * py) + c[k][2] * pz) + c[k][3];
+                    out = out | P::less(d + pr, zero);
+                }
+                count += store(P::mask(out), P::Width, visible + i);
+            }
+            #endif
+            for (; i < n; ++i) {
+                bool in = true;
+                for (size_t k = 0; k < 6; ++k) {
+                    if (distance(k, static_cast<double>(x[i]), static_cast<double>(y[i]), static_cast<double>(z[i])) + static_cast<double>(r[i]) < 0) {
+                        in = false;
+                    }
+                }
+                visible[i] = in;
+                count += in;
+            }
+            return count;
+        }
+
+        /**
+
+        @brief Tests the @param n axis-aligned boxes from ( @param lx[i], @param ly[i], @param lz[i] ) to ( @param hx[i], @param hy[i], @param hz[i] ),
+        writing 1 to @param visible[i] for those which may be inside the frustum and 0 for the rest.
+        @return Number of boxes which may be visible.
+
+        */
+
+        template <typename T>
+        size_t boxes(const T *lx, const T *ly, const T *lz, const T *hx, const T *hy, const T *hz, size_t n, uint8_t *visible) const {
+            //The corner furthest along each plane's normal takes its components from the arrays chosen by the normal's signs.
+            const T *cx[6], *cy[6], *cz[6];
+            for (size_t k = 0; k < 6; ++k) {
+                cx[k] = (planes[k][0] >= 0? hx : lx);
+                cy[k] = (planes[k][1] >= 0? hy : ly);
+                cz[k] = (planes[k][2] >= 0? hz : lz);
+            }
+            size_t i = 0, count = 0;
+            #if defined(JML_SSE2)
+            typedef _BatchPack P;
+            P c[6][4];
+            broadcast(c);
+            for (; i + P::Width <= n; i += P::Width) {
+                P zero(0.0), out = zero;
+                for (size_t k = 0; k < 6; ++k) {
+                    P d = ((c[k][0] * P::load(cx[k] + i) + c[k][1] * P::load(cy[k] + i)) + c[k][2] * P::load(cz[k] + i)) + c[k][3];
+                    out = out | P::less(d, zero);
+                }
+                count += store(P::mask(out), P::Width, visible + i);
+            }
+            #endif
+            for (; i < n; ++i) {
+                bool in = true;
+                for (size_t k = 0; k < 6; ++k) {
+                    if (distance(k, static_cast<double>(cx[k][i]), static_cast<double>(cy[k][i]), static_cast<double>(cz[k][i])) < 0) {
+                        in = false;
+                    }
+                }
+                visible[i] = in;
+                count += in;
+            }
+            return count;
+        }
+
+    private:
+
+        double planes[6][4];
+
+        ///@return The signed distance of the point ( @param x, @param y, @param z ) from the plane @param i, positive inside.
+        double distance(size_t i, double x, double y, double z) const {
+            return ((planes[i][0] * x + planes[i][1] * y) + planes[i][2] * z) + planes[i][3];
+        }
+
+        #if defined(JML_SSE2)
+
+        ///@brief Writes the coefficients of the planes to @param c, each broadcast across a register.
+        void broadcast(_BatchPack (&c)[6][4]) const {
+            for (size_t k = 0; k < 6; ++k) {
+                for (size_t j = 0; j < 4; ++j) {
+                    c[k][j] = _BatchPack(planes[k][j]);
+                }
+            }
+        }
+
+        #endif
+
+        ///@brief Writes the lanes of @param outside, a mask of @param w bits, to @param visible as 0 where set and 1 elsewhere.
+        static size_t store(int outside, size_t w, uint8_t *visible) {
+            size_t count = 0;
+            for (size_t k = 0; k < w; ++k) {
+                visible[k] = !((outside >> k) & 1);
+                count += visible[k];
+            }
+            return count;
+        }
+    };
+}
+
+#endif // JML_FRUSTUM_H
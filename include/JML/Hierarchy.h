@@ -0,0 +1,190 @@
+#ifndef JML_HIERARCHY_H
+#define JML_HIERARCHY_H
+
+/**
+
+@file       Hierarchy.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements a transform hierarchy, which caches the world matrix of every node of a scene tree along with its inverse,
+and recomputes them only for the nodes whose local transform, or whose ancestor's, changed since the last update().
+
+Each node holds a local translation, rotation and scale, applied to its children in the order scale, then rotation, then translation.
+The nodes live in flat arrays in which every parent precedes its children, so that update() is a single pass
+through memory in order: by the time a node is reached its parent's world matrix is final, and so is its parent's dirty flag,
+which the node inherits.
+
+The local matrix and its inverse are written directly from the translation, rotation and scale, so each changed node costs
+two matrix products: its parent's world matrix by its local matrix, and its inverse local matrix by its parent's inverse.
+
+*/
+
+#include <JML/Quaternion.h>
+
+///Parent of the nodes at the top of the hierarchy.
+#define JML_HIERARCHY_ROOT static_cast<size_t>(-1)
+
+namespace jml {
+
+    class TransformHierarchy {
+    public:
+
+        typedef Vector<Real, 3> VectorType;
+        typedef Quaternion<Real> RotationType;
+
+        TransformHierarchy() {}
+
+        ///@brief Reserves room for @param n nodes.
+        void reserve(size_t n) {
+            parents.reserve(n);
+            locals.reserve(n);
+            flags.reserve(n);
+            worlds.reserve(n);
+            inverses.reserve(n);
+        }
+
+        /**
+
+        @brief Adds a node with the identity transform under @param parent, which must already be in the hierarchy, or under the root.
+        @return The index of the new node, which is greater than its parent's.
+
+        */
+
+        size_t add(size_t parent = JML_HIERARCHY_ROOT) {
+            parents.insert(parent);
+            locals.insert(Local{VectorType({0, 0, 0}), RotationType(), VectorType({1, 1, 1})});
+            flags.insert(1);
+            worlds.insert(identity<Real, 4>());
+            inverses.insert(identity<Real, 4>());
+            return parents.size() - 1;
+        }
+
+        size_t size() const {
+            return parents.size();
+        }
+
+        void clear() {
+            parents.clear();
+            locals.clear();
+            flags.clear();
+            worlds.clear();
+            inverses.clear();
+        }
+
+        ///@return The parent of the node @param i, or JML_HIERARCHY_ROOT.
+        size_t parent(size_t i) const {
+            return parents[i];
+        }
+
+        const VectorType &translation(size_t i) const {
+            return locals[i].translation;
+        }
+
+        const RotationType &rotation(size_t i) const {
+            return locals[i].rotation;
+        }
+
+        const VectorType &scale(size_t i) const {
+            return locals[i].scale;
+        }
+
+        void setTranslation(size_t i, const VectorType &t) {
+            locals[i].translation = t;
+            flags[i] = 1;
+        }
+
+        ///@brief Sets the rotation of the node @param i to the unit quaternion @param r.
+        void setRotation(size_t i, const RotationType &r) {
+            locals[i].rotation = r;
+            flags[i] = 1;
+        }
+
+        ///@brief Sets the scale of the node @param i to @param s, whose components may not be 0.
+        void setScale(size_t i, const VectorType &s) {
+            locals[i].scale = s;
+            flags[i] = 1;
+        }
+
+        ///@return Whether the node @param i itself changed since the last update(). Its world matrix may be stale through an ancestor too.
+        bool dirty(size_t i) const {
+            return flags[i] != 0;
+        }
+
+        ///@return The matrix from the node @param i to the world, as of the last update().
+        const Transformation &world(size_t i) const {
+            return worlds[i];
+        }
+
+        ///@return The matrix from the world to the node @param i, as of the last update().
+        const Transformation &inverseWorld(size_t i) const {
+            return inverses[i];
+        }
+
+        ///@brief Recomputes the world matrices, and their inverses, of every node which changed or has an ancestor which changed.
+        void update() {
+            size_t n = parents.size();
+            for (size_t i = 0; i < n; ++i) {
+                size_t p = parents[i];
+                if (p != JML_HIERARCHY_ROOT && flags[p]) {
+                    flags[i] = 1;
+                }
+                if (!flags[i]) continue;
+                Transformation local, inverse;
+                matrices(locals[i], local, inverse);
+                if (p == JML_HIERARCHY_ROOT) {
+                    worlds[i] = local;
+                    inverses[i] = inverse;
+                } else {
+                    worlds[i] = worlds[p] * local;
+                    inverses[i] = inverse * inverses[p];
+                }
+            }
+            //Flags are cleared only after the pass, since every child reads its parent's.
+            for (size_t i = 0; i < n; ++i) {
+                flags[i] = 0;
+            }
+        }
+
+    private:
+
+        struct Local {
+            VectorType translation;
+            RotationType rotation;
+            VectorType scale;
+        };
+
+        jutil::Queue<size_t> parents;
+        jutil::Queue<Local> locals;
+        jutil::Queue<uint8_t> flags;
+        jutil::Queue<Transformation> worlds, inverses;
+
+        /**
+
+        @brief Writes the local matrix of @param l, T R S, to @param m and its inverse, S^-1 R^T T^-1, to @param inverse.
+        The inverse of the rotation is its transpose, so neither needs a general matrix inversion.
+
+        */
+
+        static void matrices(const Local &l, Transformation &m, Transformation &inverse) {
+            Matrix<Real, 3, 3> r = l.rotation.matrix();
+            m = identity<Real, 4>();
+            inverse = identity<Real, 4>();
+            for (size_t i = 0; i < 3; ++i) {
+                Real k = 1 / l.scale[i];
+                for (size_t j = 0; j < 3; ++j) {
+                    m[i][j] = r[i][j] * l.scale[j];
+                    inverse[i][j] = r[j][i] * k;
+                }
+                m[i][3] = l.translation[i];
+            }
+            for (size_t i = 0; i < 3; ++i) {
+                inverse[i][3] = -(inverse[i][0] * l.translation[0] + inverse[i][1] * l.translation[1] + inverse[i][2] * l.translation[2]);
+            }
+        }
+    };
+}
+
+#endif // JML_HIERARCHY_H
@@ -0,0 +1,322 @@
+#ifndef JML_KD_TREE_H
+#define JML_KD_TREE_H
+
+/**
+
+@file       KDTree.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements a k-d tree over points in N dimensions, which answers nearest neighbour, radius and box queries
+in time logarithmic in the number of points, in place of comparing the query against every point with distance().
+
+The tree has no nodes of its own. The points are copied into one array and arranged so that every range of it is a subtree:
+the median of the range on the axis of greatest spread sits in its middle, with the points below it to the left and those above it
+to the right. Ranges of JML_KD_LEAF points or fewer are leaves, which are scanned linearly. Only the split axis of each median is stored.
+
+Queries compare squared distances throughout, so no square root is taken.
+
+Define JML_THREADS to enable the constructor which builds the subtrees of the upper levels on separate threads.
+
+*/
+
+#include <JML/Vector.hpp>
+#include <JML/sorting.h>
+
+#ifdef JML_THREADS
+    #include <thread>
+#endif
+
+#define JML_KD_LEAF         8
+///Smallest range that the threaded build hands to a thread of its own.
+#define JML_KD_THREAD_MIN   65536
+
+namespace jml {
+
+    /**
+
+    @brief k-d tree over points of type Vector<T, N>.
+    @param T: Scalar type of the coordinates.
+    @param N: Number of dimensions.
+
+    */
+
+    template <typename T, size_t N>
+    class KDTree {
+    public:
+
+        typedef Vector<T, N> PointType;
+
+        ///A point found by a query: its index in the order given at construction, and its squared distance from the query point.
+        struct Neighbour {
+            size_t index;
+            T distanceSquared;
+
+            bool operator<(const Neighbour &n) const {
+                return distanceSquared < n.distanceSquared;
+            }
+        };
+
+        KDTree() {}
+
+        ///@brief Builds the tree over the points [ @param begin, @param end ).
+        template <typename I>
+        KDTree(I begin, I end) {
+            load(begin, end);
+            build(0, entries.size());
+            store();
+        }
+
+        #ifdef JML_THREADS
+
+        ///@brief Builds the tree over the points [ @param begin, @param end ), splitting the work across @param threads threads.
+        template <typename I>
+        KDTree(I begin, I end, unsigned threads) {
+            load(begin, end);
+            build(0, entries.size(), threads);
+            store();
+        }
+
+        #endif
+
+        size_t size() const {
+            return points.size();
+        }
+
+        ///@return The point of index @param i, in the order given at construction.
+        const PointType &point(size_t i) const {
+            return points[positions[i]];
+        }
+
+        /**
+
+        @brief Finds the @param k points nearest to @param q and writes them to @param out, nearest first.
+        Fewer are written when the tree holds fewer than k points.
+
+        */
+
+        void nearest(const PointType &q, size_t k, jutil::Queue<Neighbour> &out) const {
+            out.clear();
+            if (k && points.size()) {
+                nearest(q, k, out, 0, points.size());
+                _sortHeap(out.begin(), out.end());
+            }
+        }
+
+        ///@return The point nearest to @param q. The tree may not be empty.
+        Neighbour nearest(const PointType &q) const {
+            jutil::Queue<Neighbour> out;
+            nearest(q, 1, out);
+            return out[0];
+        }
+
+        ///@brief Writes every point within distance @param r of @param q to @param out, in no particular order.
+        void radius(const PointType &q, T r, jutil::Queue<Neighbour> &out) const {
+            out.clear();
+            radius(q, r * r, out, 0, points.size());
+        }
+
+        ///@brief Writes the indices of every point in the box from @param lo to @param hi, inclusive, to @param out.
+        void box(const PointType &lo, const PointType &hi, jutil::Queue<size_t> &out) const {
+            out.clear();
+            box(lo, hi, out, 0, points.size());
+        }
+
+    private:
+
+        ///The points in tree order, the index given at construction of each, the position of each index, and the split axis of each median.
+        jutil::Queue<PointType> points;
+        jutil::Queue<size_t> indices, positions;
+        jutil::Queue<uint8_t> axes;
+
+        ///A point and its index, which the build moves together so that partitioning reads memory in order.
+        struct Entry {
+            PointType point;
+            size_t index;
+        };
+
+        jutil::Queue<Entry> entries;
+
+        template <typename I>
+        void load(I begin, I end) {
+            size_t n = 0;
+            for (I i = begin; i != end; ++i) {
+                entries.insert(Entry{PointType(*i), n++});
+            }
+            axes.resize(n);
+        }
+
+        ///@brief Moves the entries, in the order the build left them, into the arrays the queries read.
+        void store() {
+            size_t n = entries.size();
+            points.resize(n);
+            indices.resize(n);
+            positions.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                points[i] = entries[i].point;
+                indices[i] = entries[i].index;
+                positions[entries[i].index] = i;
+            }
+            entries.clear();
+        }
+
+        static T distanceSquared(const PointType &a, const PointType &b) {
+            T d = 0;
+            for (size_t i = 0; i < N; ++i) {
+                T c = a[i] - b[i];
+                d += c * c;
+            }
+            return d;
+        }
+
+        ///@brief Places the median of the range [ @param b, @param e ) on its axis of greatest spread in its middle, and splits the range there.
+        size_t split(size_t b, size_t e) {
+            PointType lo = entries[b].point, hi = lo;
+            for (size_t i = b + 1; i < e; ++i) {
+                const PointType &p = entries[i].point;
+                for (size_t j = 0; j < N; ++j) {
+                    lo[j] = (p[j] < lo[j]? p[j] : lo[j]);
+                    hi[j] = (p[j] > hi[j]? p[j] : hi[j]);
+                }
+            }
+            size_t axis = 0;
+            for (size_t j = 1; j < N; ++j) {
+                if (hi[j] - lo[j] > hi[axis] - lo[axis]) {
+                    axis = j;
+                }
+            }
+            size_t m = b + (e - b) / 2;
+            _nthElement(entries.begin() + b, entries.begin() + m, entries.begin() + e, [axis](const Entry &i, const Entry &j) {
+                return i.point[axis] < j.point[axis];
+            });
+            axes[m] = static_cast<uint8_t>(axis);
+            return m;
+        }
+
+        void build(size_t b, size_t e) {
+            if (e - b > JML_KD_LEAF) {
+                size_t m = split(b, e);
+                build(b, m);
+                build(m + 1, e);
+            }
+        }
+
+        #ifdef JML_THREADS
+
+        ///@brief Builds the subtree [ @param b, @param e ), handing its left half to a new thread while @param threads allows.
+        void build(size_t b, size_t e, unsigned threads) {
+            if (threads <= 1 || e - b < JML_KD_THREAD_MIN) {
+                build(b, e);
+                return;
+            }
+            size_t m = split(b, e);
+            std::thread left([this, b, m, threads]() {
+                build(b, m, threads / 2);
+            });
+            build(m + 1, e, threads - threads / 2);
+            left.join();
+        }
+
+        #endif
+
+        void nearest(const PointType &q, size_t k, jutil::Queue<Neighbour> &out, size_t b, size_t e) const {
+            if (e - b <= JML_KD_LEAF) {
+                for (size_t i = b; i < e; ++i) {
+                    offer(Neighbour{i, distanceSquared(q, points[i])}, k, out);
+                }
+                return;
+            }
+            size_t m = b + (e - b) / 2, axis = axes[m];
+            offer(Neighbour{m, distanceSquared(q, points[m])}, k, out);
+            T d = q[axis] - points[m][axis];
+            //Searches the side of the query point first, then the other side only if it is nearer than the kth neighbour so far.
+            if (d < 0) {
+                nearest(q, k, out, b, m);
+                if (out.size() < k || d * d < out[0].distanceSquared) {
+                    nearest(q, k, out, m + 1, e);
+                }
+            } else {
+                nearest(q, k, out, m + 1, e);
+                if (out.size() < k || d * d < out[0].distanceSquared) {
+                    nearest(q, k, out, b, m);
+                }
+            }
+        }
+
+        ///@brief Keeps @param n in the max-heap @param out of the @param k nearest points so far, translating its position to an index.
+        void offer(Neighbour n, size_t k, jutil::Queue<Neighbour> &out) const {
+            if (out.size() == k && !(n.distanceSquared < out[0].distanceSquared)) return;
+            n.index = indices[n.index];
+            if (out.size() < k) {
+                out.insert(n);
+                _pushHeap(out.begin(), out.end());
+            } else {
+                _popHeap(out.begin(), out.end());
+                out[k - 1] = n;
+                _pushHeap(out.begin(), out.end());
+            }
+        }
+
+        void radius(const PointType &q, T r2, jutil::Queue<Neighbour> &out, size_t b, size_t e) const {
+            if (e - b <= JML_KD_LEAF) {
+                for (size_t i = b; i < e; ++i) {
+                    T d = distanceSquared(q, points[i]);
+                    if (d <= r2) {
+                        out.insert(Neighbour{indices[i], d});
+                    }
+                }
+                return;
+            }
+            size_t m = b + (e - b) / 2, axis = axes[m];
+            T dm = distanceSquared(q, points[m]);
+            if (dm <= r2) {
+                out.insert(Neighbour{indices[m], dm});
+            }
+            T d = q[axis] - points[m][axis];
+            if (d <= 0 || d * d <= r2) {
+                radius(q, r2, out, b, m);
+            }
+            if (d >= 0 || d * d <= r2) {
+                radius(q, r2, out, m + 1, e);
+            }
+        }
+
+        void box(const PointType &lo, const PointType &hi, jutil::Queue<size_t> &out, size_t b, size_t e) const {
+            if (e - b <= JML_KD_LEAF) {
+                for (size_t i = b; i < e; ++i) {
+                    if (inBox(lo, hi, points[i])) {
+                        out.insert(indices[i]);
+                    }
+                }
+                return;
+            }
+            size_t m = b + (e - b) / 2, axis = axes[m];
+            if (inBox(lo, hi, points[m])) {
+                out.insert(indices[m]);
+            }
+            if (lo[axis] <= points[m][axis]) {
+                box(lo, hi, out, b, m);
+            }
+            if (hi[axis] >= points[m][axis]) {
+                box(lo, hi, out, m + 1, e);
+            }
+        }
+
+        static bool inBox(const PointType &lo, const PointType &hi, const PointType &p) {
+            for (size_t i = 0; i < N; ++i) {
+                if (p[i] < lo[i] || p[i] > hi[i]) return false;
+            }
+            return true;
+        }
+    };
+
+    ///typedefs
+    typedef KDTree<float, 2> KDTree2f;
+    typedef KDTree<float, 3> KDTree3f;
+    typedef KDTree<double, 2> KDTree2d;
+    typedef KDTree<double, 3> KDTree3d;
+}
+
+#endif // JML_KD_TREE_H
@@ -0,0 +1,184 @@
+#ifndef JML_LU_H
+#define JML_LU_H
+
+/**
+
+@file       LU.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements an LU decomposition with partial pivoting, which computes determinants, inverses and linear solutions of square matrices in O(n^3).
+
+*/
+
+#include <JML/Matrix.h>
+
+namespace jml {
+
+    /**
+
+    @brief Factors a square matrix A as PA = LU, where P is a row permutation, L is unit lower triangular and U is upper triangular.
+    The factorization is computed once on construction and can then be reused for any number of solves.
+
+    @param T: Numerical type used for the factorization.
+    @param n: Number of rows and columns in the factored matrix.
+
+    */
+
+    template <typename T, size_t n>
+    class LUDecomposition {
+    public:
+
+        template <typename E>
+        LUDecomposition(const MatrixExpression<E> &m) : parity(1), isSingular(false) {
+            static_assert(E::nRows == n && E::nCols == n, "Attempting to decompose nonsquare matrix.");
+            const E &e = m.self();
+            for (size_t i = 0; i < n; ++i) {
+                perm[i] = i;
+                for (size_t j = 0; j < n; ++j) {
+                    lu[i * n + j] = static_cast<T>(e.get(i, j));
+                }
+            }
+            factor();
+        }
+
+        /**
+
+        @return [true]: The matrix has no inverse; determinant() is 0 and inverse() and solve() are undefined.
+        @return [false]: The matrix is invertible.
+
+        */
+
+        bool singular() const {
+            return isSingular;
+        }
+
+        ///@return Determinant of the decomposed matrix.
+        T determinant() const {
+            T r = static_cast<T>(parity);
+            for (size_t i = 0; i < n; ++i) {
+                r *= lu[i * n + i];
+            }
+            return r;
+        }
+
+        ///@return The vector x such that Ax = @param b.
+        template <typename E>
+        Vector<T, n> solve(const VectorExpression<E> &b) const {
+            static_assert(E::nLength == n, "Solving against vector of mismatched length.");
+            const E &e = b.self();
+            Vector<T, n> x;
+            for (size_t i = 0; i < n; ++i) {
+                x[i] = static_cast<T>(e.get(perm[i]));
+            }
+            substitute(x.data());
+            return x;
+        }
+
+        ///@return Inverse of the decomposed matrix.
+        Matrix<T, n, n> inverse() const {
+            Matrix<T, n, n, ColumnMajor> r;
+            T *d = r.data();
+            for (size_t j = 0; j < n; ++j) {
+                for (size_t i = 0; i < n; ++i) {
+                    d[j * n + i] = (perm[i] == j? static_cast<T>(1) : static_cast<T>(0));
+                }
+                substitute(d + j * n);
+            }
+            return r;
+        }
+
+        ///@return The unit lower triangular factor L.
+        Matrix<T, n, n> lower() const {
+            Matrix<T, n, n> r;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    r[i][j] = lu[i * n + j];
+                }
+                r[i][i] = static_cast<T>(1);
+            }
+            return r;
+        }
+
+        ///@return The upper triangular factor U.
+        Matrix<T, n, n> upper() const {
+            Matrix<T, n, n> r;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = i; j < n; ++j) {
+                    r[i][j] = lu[i * n + j];
+                }
+            }
+            return r;
+        }
+
+        ///@return Index of the row of the original matrix which was moved to row @param i.
+        size_t pivot(size_t i) const {
+            return perm[i];
+        }
+
+    private:
+        T lu[n * n];
+        size_t perm[n];
+        int8_t parity;
+        bool isSingular;
+
+        void factor() {
+            for (size_t k = 0; k < n; ++k) {
+                size_t p = k;
+                T best = abs(lu[k * n + k]);
+                for (size_t i = k + 1; i < n; ++i) {
+                    T v = abs(lu[i * n + k]);
+                    if (v > best) {
+                        best = v;
+                        p = i;
+                    }
+                }
+                if (best == static_cast<T>(0)) {
+                    isSingular = true;
+                    continue;
+                }
+                if (p != k) {
+                    for (size_t j = 0; j < n; ++j) {
+                        T t = lu[k * n + j];
+                        lu[k * n + j] = lu[p * n + j];
+                        lu[p * n + j] = t;
+                    }
+                    size_t t = perm[k];
+                    perm[k] = perm[p];
+                    perm[p] = t;
+                    parity = -parity;
+                }
+                T inv = static_cast<T>(1) / lu[k * n + k];
+                for (size_t i = k + 1; i < n; ++i) {
+                    T f = lu[i * n + k] * inv;
+                    lu[i * n + k] = f;
+                    for (size_t j = k + 1; j < n; ++j) {
+                        lu[i * n + j] -= f * lu[k * n + j];
+                    }
+                }
+            }
+        }
+
+        ///Solves LUx = b in place, where @param x holds the permuted b.
+        void substitute(T *x) const {
+            for (size_t i = 1; i < n; ++i) {
+                T s = x[i];
+                for (size_t j = 0; j < i; ++j) {
+                    s -= lu[i * n + j] * x[j];
+                }
+                x[i] = s;
+            }
+            for (size_t i = n; i-- > 0;) {
+                T s = x[i];
+                for (size_t j = i + 1; j < n; ++j) {
+                    s -= lu[i * n + j] * x[j];
+                }
+                x[i] = s / lu[i * n + i];
+            }
+        }
+    };
+}
+
+#endif // JML_LU_H
@@ -20,7 +20,7 @@ namespace jml {
             bool i = intersects(line);
 
             if (crossover && i) {
-                long double cxd = slope() - line.slope();
+                Real cxd = slope() - line.slope();
                 if (compare(cxd, 0) != JML_EQUAL) {
                     crossover->x() = (line.intercept().y() - intercept().y()) / cxd;
                     crossover->y() = (slope() * crossover->x()) + intercept().y();
@@ -35,9 +35,9 @@ namespace jml {
             else return true;
         }
 
-        Vector2ld intercept() const {
-            long double yIntercept = vA.y() - (slope() * vA.x());
-            long double xIntercept = -yIntercept / slope();
+        Vector<Real, 2> intercept() const {
+            Real yIntercept = vA.y() - (slope() * vA.x());
+            Real xIntercept = -yIntercept / slope();
             return {xIntercept, yIntercept};
         }
         /*LineSegment terminatingSegment() const {
@@ -12,49 +12,37 @@ namespace jml {
     public:
         LineSegment(const Vertex &a, const Vertex &b) : Trace(a, b) {}
 
-        long double length() const {
+        Real length() const {
             return distance(vA, vB);
         }
 
         bool intersects(const LineSegment &ls) const {
             if (ls.vA == vA || ls.vA == vB || ls.vB == vA || ls.vB == vB) return endpointIntersectionEnabled();
 
-            Line la(vA, vB), lb(ls.vA, ls.vB);
-            if (la.parallelTo(lb) && la.intersects(lb)) return (hasPoint(ls.vA) || hasPoint(ls.vB));
-
-            char ccw1, ccw2;
-            ccw1 = ccw(vA, vB, ls.vA) * ccw(vA, vB, ls.vB);
-            ccw2 = ccw(ls.vA, ls.vB, vA) * ccw(ls.vA, ls.vB, vB);
-            return (ccw1 <= 0) && (ccw2 <= 0);
+            int8_t a = ccw(vA, vB, ls.vA), b = ccw(vA, vB, ls.vB);
+            if (a == JML_COLLINEAR && b == JML_COLLINEAR) {
+                //Collinear segments meet exactly when one contains an endpoint of the other.
+                return boxHas(vA, vB, ls.vA) || boxHas(vA, vB, ls.vB) || boxHas(ls.vA, ls.vB, vA) || boxHas(ls.vA, ls.vB, vB);
+            }
+            return (a * b <= 0) && (ccw(ls.vA, ls.vB, vA) * ccw(ls.vA, ls.vB, vB) <= 0);
         }
 
         bool hasPoint(const Vertex &p) const {
             if (!endpointIntersectionEnabled() && (p == vA || p == vB)) return false;
-            if (ccw(vA, p, vB) == JML_COLLINEAR) {
-                char
-                    cmpABX = compare(vA.x(), vB.x()),
-                    cmpAPX = compare(vA.x(), p.x()),
-                    cmpBPX = compare(vB.x(), p.x()),
-                    cmpAPY = compare(vA.y(), p.y()),
-                    cmpBPY = compare(vB.y(), p.y())
-                ;
-                if (cmpABX != JML_EQUAL) {
-                    return (
-                        ((cmpAPX == JML_LESS || cmpAPX == JML_EQUAL) && (cmpBPX == JML_GREATER || cmpBPX == JML_EQUAL)) ||
-                        ((cmpBPX == JML_LESS || cmpBPX == JML_EQUAL) && (cmpAPX == JML_GREATER || cmpAPX == JML_EQUAL))
-                    );
-                }
-                else {
-                    return (
-                        ((cmpAPY == JML_LESS || cmpAPY == JML_EQUAL) && (cmpBPY == JML_GREATER || cmpBPY == JML_EQUAL)) ||
-                        ((cmpBPY == JML_LESS || cmpBPY == JML_EQUAL) && (cmpAPY == JML_GREATER || cmpAPY == JML_EQUAL))
-                    );
-                }
-            } else return false;
+            return ccw(vA, p, vB) == JML_COLLINEAR && boxHas(vA, vB, p);
         }
 
         Vertex midPoint() const {
-            return (vA + vB) / 2.L;
+            return (vA + vB) / 2;
+        }
+
+    private:
+        ///@return [true]: @param p lies in the bounding box of @param a and @param b, which for a collinear p means on the segment ab.
+        static bool boxHas(const Vertex &a, const Vertex &b, const Vertex &p) {
+            return (
+                (a.x() <= b.x()? a.x() <= p.x() && p.x() <= b.x() : b.x() <= p.x() && p.x() <= a.x()) &&
+                (a.y() <= b.y()? a.y() <= p.y() && p.y() <= b.y() : b.y() <= p.y() && p.y() <= a.y())
+            );
         }
     };
 
@@ -10,7 +10,16 @@
 #endif
 
 #include <JML/Ray.h>
+#include <JML/Primitives.h>
+#include <JML/sweep.h>
+#include <JML/BVH.h>
+#include <JML/KDTree.h>
 #include <JML/Matrix.h>
+#include <JML/Quaternion.h>
+#include <JML/Affine.h>
+#include <JML/Hierarchy.h>
+#include <JML/VertexBuffer.h>
+#include <JML/Frustum.h>
 #include <JML/Fraction.hpp>
 
 #endif // JML_H
@@ -14,6 +14,7 @@ Implements a Matrix class designed to mimic the behaviour of mathematical Matric
 */
 
 #include <JML/Vector.hpp>
+#include <JML/closedform.h>
 
 ///error codes
 #define MATERR                          0x02
@@ -30,35 +31,42 @@ namespace jml {
     @param T: Base numerical type to be stored in the matrix.
     @param rows: Number of rows in the matrix.
     @param cols: Numbers of columns in the matrix.
+    @param Layout: Storage order of the elements, either RowMajor or ColumnMajor. @see View.h
     @param Enforces a minumum number of rows of 2.
     @param Enforces a minimum number of rows of 2.
 
+    All elements are stored inline in one contiguous block of rows * cols values.
+
     */
     template<
         typename T,
         size_t rows,
         size_t cols,
+        typename Layout,
         typename
     >
-    class Matrix : public jutil::StringInterface {
+    class Matrix : public MatrixExpression<Matrix<T, rows, cols, Layout> > {
 
     public:
 
         static constexpr size_t nRows = rows;
         static constexpr size_t nCols = cols;
 
-        typedef Matrix<T, rows, cols> Type;
+        typedef Matrix<T, rows, cols, Layout> Type;
         typedef T ValueType;
+        typedef Layout LayoutType;
 
         typedef std::initializer_list<std::initializer_list<ValueType> > Literal;
-        typedef Vector<ValueType, cols> *Iterator;
-        typedef const Vector<ValueType, cols>* ConstIterator;
+        typedef VectorView<ValueType, cols> Row;
+        typedef VectorView<const ValueType, cols> ConstRow;
+        typedef RowIterator<ValueType, cols> Iterator;
+        typedef RowIterator<const ValueType, cols> ConstIterator;
 
         void array(T arr[rows * cols]) {
             size_t c = 0;
             for (size_t i = 0; i < rows; ++i) {
                 for (size_t j = 0; j < cols; ++j) {
-                    arr[c] = (*this)[i][j];
+                    arr[c] = get(i, j);
                     ++c;
                 }
             }
@@ -66,12 +74,26 @@ namespace jml {
 
         /**
 
+        @return Pointer to the matrix's contiguous element storage, ordered according to @param Layout.
+
+        */
+
+        T *data() {
+            return rawMatrix;
+        }
+
+        const T *data() const {
+            return rawMatrix;
+        }
+
+        /**
+
         @brief Constructor which fills all of the spaces in the matrix with 0.
 
         */
 
         Matrix() {
-            populateRows(static_cast<ValueType>(0));
+            fill(static_cast<ValueType>(0));
         }
 
         /**
@@ -81,7 +103,7 @@ namespace jml {
         */
 
         Matrix(const ValueType &n) {
-            populateRows(n);
+            fill(n);
         }
 
         /**
@@ -91,18 +113,29 @@ namespace jml {
         */
 
         Matrix(Literal m) {
-            data.reserve(rows);
-            for (size_t i = 0; i < rows; ++i) {
-                if (i < m.size()) {
-                    data.insert(Vector<T, cols>(*(m.begin() + i)));
-                } else {
-                    data.insert(Vector<T, cols>(static_cast<T>(0)));
+            fill(static_cast<ValueType>(0));
+            for (size_t i = 0; i < rows && i < m.size(); ++i) {
+                const std::initializer_list<ValueType> &row = *(m.begin() + i);
+                for (size_t j = 0; j < cols && j < row.size(); ++j) {
+                    at(i, j) = *(row.begin() + j);
                 }
             }
         }
 
         /**
 
+        @brief Constructor which evaluates the matrix, view or expression @param m.
+
+        */
+
+        template <typename E>
+        Matrix(const MatrixExpression<E> &m) {
+            static_assert(E::nRows == rows && E::nCols == cols, "Constructing matrix from expression of mismatched size.");
+            copy(m.self());
+        }
+
+        /**
+
         @return Value in matrix at position ( @param x, @param y ).
         @param x: Row index to search.
         @param y: Column index to search.
@@ -110,44 +143,44 @@ namespace jml {
         */
 
         T get(size_t x, size_t y) const {
-            return getRow(x).get(y);
+            return rawMatrix[index(x, y)];
         }
 
         /**
 
-        @return Vector containing all of the values in matrix's row @param i.
+        @return View of the values in matrix's row @param i.
         @param i: Row index.
 
         */
 
-        Vector<T, cols> getRow(size_t i) const {
-            return data[i];
+        ConstRow getRow(size_t i) const {
+            return ConstRow(rawMatrix + i * rowStride(), colStride());
         }
 
         /**
 
-        @return Vector containing all of the values in matrix's column @param i.
+        @return View of the values in matrix's column @param i.
         @param i: Column index.
 
         */
 
-        Vector<T, rows> getCol(size_t i) const {
-            Vector<T, rows> result;
-            for (size_t j = 0; j < rows; ++j) {
-                result[static_cast<size_t>(j)] = getRow(j).get(i);
-            }
-            return result;
+        VectorView<const T, rows> getCol(size_t i) const {
+            return VectorView<const T, rows>(rawMatrix + i * colStride(), rowStride());
         }
 
         /**
 
-        @return Reference to a vector containing all of the values in matrix's row @param i.
+        @return View through which the values in matrix's row @param i can be modified.
         @param i: Row index.
 
         */
 
-        Vector<T, cols> &operator[](size_t i) {
-            return data[i];
+        Row operator[](size_t i) {
+            return Row(rawMatrix + i * rowStride(), colStride());
+        }
+
+        ConstRow operator[](size_t i) const {
+            return getRow(i);
         }
 
         /**
@@ -172,42 +205,42 @@ namespace jml {
 
         /**
 
-        @return Pointer to the first row of the matrix.
+        @return Iterator to the first row of the matrix.
 
         */
 
         Iterator begin() {
-            return &((*this)[0]);
+            return Iterator(rawMatrix, rowStride(), colStride());
         }
 
         /**
 
-        @return Const pointer to the first row of the matrix.
+        @return Const iterator to the first row of the matrix.
 
         */
 
         ConstIterator begin() const {
-            return &((*this)[0]);
+            return ConstIterator(rawMatrix, rowStride(), colStride());
         }
 
         /**
 
-        @return Pointer to the last row of the matrix.
+        @return Iterator past the last row of the matrix.
 
         */
 
         Iterator end() {
-            return (&((*this)[rows - 1]) + 1);
+            return Iterator(rawMatrix + rows * rowStride(), rowStride(), colStride());
         }
 
         /**
 
-        @return Const pointer to the last row of the matrix.
+        @return Const iterator past the last row of the matrix.
 
         */
 
         ConstIterator end() const {
-            return (&((*this)[rows - 1]) + 1);
+            return ConstIterator(rawMatrix + rows * rowStride(), rowStride(), colStride());
         }
 
         /**
@@ -223,7 +256,7 @@ namespace jml {
 
         /**
 
-        @return Matrix Identical to the current matrix excluding row @param er and column @param ec.
+        @return View of the current matrix excluding row @param er and column @param ec.
         @param fRows: Number of rows to be in the resulting matrix. Should always be passed as 1 less than the number of rows in the matrix.
         @param fCols: Number of columns to be in the resulting matrix. Should always be passed as 1 less than the number of columns in the matrix.
         @param er: Row index to be excluded from matrix.
@@ -233,19 +266,8 @@ namespace jml {
         */
 
         template <size_t fRows, size_t fCols>
-        Matrix<T, fRows, fCols> subMatrix(size_t er, size_t ec) const {
-            Matrix<T, fRows, fCols> result;
-            int8_t r = -1;
-            for (size_t i = 0; i < rows; ++i) {
-                if (i == er) continue;
-                ++r;
-                int8_t c = -1;
-                for (size_t j = 0; j < cols; ++j) {
-                    if (j == ec) continue;
-                    result[r][++c] = get(i, j);
-                }
-            }
-            return result;
+        SubMatrixView<const T, fRows, fCols> subMatrix(size_t er, size_t ec) const {
+            return SubMatrixView<const T, fRows, fCols>(rawMatrix, rowStride(), colStride(), er, ec);
         }
 
         /**
@@ -255,22 +277,9 @@ namespace jml {
 
         */
 
-        long double determinant() const {
+        Real determinant() const {
             static_assert(rows == cols, "Attempting to calculate determinant of nonsquare matrix.");
-            JUTIL_IFCX_(rows == 2) {
-                return ((static_cast<long double>(this->get(0, 0)) * static_cast<long double>(this->get(1, 1))) - (static_cast<long double>(this->get(0, 1)) * static_cast<long double>(this->get(1, 0))));
-            } else {
-                long double r = 0;
-                int8_t s = 1;
-                for (size_t i = 0; i < cols; ++i) {
-                    constexpr size_t rr = (rows <= 2? rows : rows - 1);
-                    constexpr size_t cc = (cols <= 2? cols : cols - 1);
-                    Matrix<T, rr, cc> sub = subMatrix<rr, cc>(0, i);
-                    r += static_cast<long double>(s) * static_cast<long double>(this->get(0, i)) * sub.determinant();
-                    s *= -1;
-                }
-                return r;
-            }
+            return determinant(_Choose<_ClosedForm<rows>::Value>());
         }
 
         /**
@@ -280,24 +289,22 @@ namespace jml {
 
         */
 
-        Matrix<long double, rows, cols> cofactor() const {
+        Matrix<Real, rows, cols> cofactor() const {
             static_assert(rows == cols, "Attempting to calculate cofactor of nonsquare matrix.");
             JUTIL_IFCX_(rows == 2 && cols == 2) {
-                Matrix<long double, rows, cols> result({
-                    {static_cast<long double>(get(1, 1)), static_cast<long double>(get(1, 0) * -1.0L)},
-                    {static_cast<long double>(get(0, 1) * -1.0L), static_cast<long double>(get(0, 0))}
+                Matrix<Real, rows, cols> result({
+                    {static_cast<Real>(get(1, 1)), static_cast<Real>(get(1, 0) * -1)},
+                    {static_cast<Real>(get(0, 1) * -1), static_cast<Real>(get(0, 0))}
                 });
                 return result;
             } else {
-                Matrix<long double, rows, cols> m;
-                int8_t s = 1;
+                Matrix<Real, rows, cols> m;
                 for (size_t i = 0; i < rows; ++i) {
                     for (size_t j = 0; j < cols; ++j) {
                         constexpr size_t rr = (rows <= 2? rows : rows - 1);
                         constexpr size_t cc = (cols <= 2? cols : cols - 1);
                         Matrix<T, rr, cc> sub = subMatrix<rr, cc>(i, j);
-                        m[i][j] = sub.determinant() * static_cast<long double>(s);
-                        s *= -1;
+                        m[i][j] = sub.determinant() * ((i + j) % 2 == 0? 1 : -1);
                     }
                 }
                 return m;
@@ -306,16 +313,12 @@ namespace jml {
 
         /**
 
-        @return Transpose of the matrix.
+        @return View of the transpose of the matrix.
 
         */
 
-        Matrix<T, cols, rows> transpose() const {
-            Matrix<T, cols, rows> result;
-            for (size_t i = 0; i < cols; ++i) {
-                result[i] = getCol(i);
-            }
-            return result;
+        MatrixView<const T, cols, rows> transpose() const {
+            return MatrixView<const T, cols, rows>(rawMatrix, colStride(), rowStride());
         }
 
         /**
@@ -325,12 +328,12 @@ namespace jml {
 
         */
 
-        Matrix<long double, rows, cols> adjugate() const {
+        Matrix<Real, rows, cols> adjugate() const {
             static_assert(rows == cols, "Attempting to calculate adjugate of nonsquare matrix.");
             JUTIL_IFCX_(rows == 2 && cols == 2) {
-                Matrix<long double, rows, cols> result({
-                    {static_cast<long double>(get(1, 1)), static_cast<long double>(get(0, 1) * -1.0L)},
-                    {static_cast<long double>(get(1, 0) * -1.0L), static_cast<long double>(get(0, 0))}
+                Matrix<Real, rows, cols> result({
+                    {static_cast<Real>(get(1, 1)), static_cast<Real>(get(0, 1) * -1)},
+                    {static_cast<Real>(get(1, 0) * -1), static_cast<Real>(get(0, 0))}
                 });
                 return result;
             } else {
@@ -345,82 +348,78 @@ namespace jml {
 
         */
 
-        Matrix<long double, rows, cols> inverse() const {
+        Matrix<Real, rows, cols> inverse() const {
             static_assert(rows == cols, "Attempting to invert nonsquare matrix.");
-            return adjugate() * (1.0L / determinant());
+            return inverse(_Choose<_ClosedForm<rows>::Value>());
         }
 
         /**
 
-        @brief Addition operator between two matrices.
+        @return Inverse of an affine transformation, whose last row is (0, 0, 0, 1).
+        Only the upper-left 3x3 block is inverted; the translation is then carried through it.
+        @warning Only usable with 4x4 matrices. The last row is assumed, not checked.
 
         */
 
-        template <typename U>
-        auto operator+(const Matrix<U, rows, cols> &b) const -> Matrix<ADD_T(T, U), rows, cols> {
-            Matrix<ADD_T(T, U), rows, cols> result;
-            for (size_t i = 0; i < rows; ++i) {
-                for (size_t j = 0; j < cols; ++j) {
-                    result[i][j] = static_cast<ADD_T(T, U)>(this->get(i, j)) + static_cast<ADD_T(T, U)>(b.get(i, j));
-                }
-            }
-            return result;
+        Matrix<Real, rows, cols> affineInverse() const {
+            static_assert(rows == 4 && cols == 4, "Attempting to affine-invert a matrix which is not 4x4.");
+            Real a[9] = {
+                static_cast<Real>(get(0, 0)), static_cast<Real>(get(0, 1)), static_cast<Real>(get(0, 2)),
+                static_cast<Real>(get(1, 0)), static_cast<Real>(get(1, 1)), static_cast<Real>(get(1, 2)),
+                static_cast<Real>(get(2, 0)), static_cast<Real>(get(2, 1)), static_cast<Real>(get(2, 2))
+            }, r[9];
+            jml::inverse(a, r);
+            return composeInverse(r);
         }
 
         /**
 
-        @brief Subtraction operator between two matrices.
+        @return Inverse of a rigid-body transformation, made only of a rotation and a translation.
+        The rotation block is transposed rather than inverted.
+        @warning Only usable with 4x4 matrices. The upper-left 3x3 block is assumed to be orthonormal, not checked.
 
         */
 
-        template <typename U>
-        auto operator-(const Matrix<U, rows, cols> &b) const -> Matrix<SUBTRACT_T(T, U), rows, cols> {
-            return *this + (b * -1);
+        Matrix<Real, rows, cols> rigidInverse() const {
+            static_assert(rows == 4 && cols == 4, "Attempting to rigid-invert a matrix which is not 4x4.");
+            Real r[9] = {
+                static_cast<Real>(get(0, 0)), static_cast<Real>(get(1, 0)), static_cast<Real>(get(2, 0)),
+                static_cast<Real>(get(0, 1)), static_cast<Real>(get(1, 1)), static_cast<Real>(get(2, 1)),
+                static_cast<Real>(get(0, 2)), static_cast<Real>(get(1, 2)), static_cast<Real>(get(2, 2))
+            };
+            return composeInverse(r);
         }
 
         /**
 
-        @brief Multiplication operator matrix and scalar.
+        @return LU decomposition of the matrix, which can be reused for repeated solves. @see LU.h
+        @warning Only usable with with square matrices.
 
         */
 
-        template <typename U>
-        auto operator*(const U &n) const -> Matrix<MULTIPLY_T(T, U), rows, cols> {
-            Matrix<MULTIPLY_T(T, U), rows, cols> result;
-            for (size_t i = 0; i < rows; ++i) {
-                for (size_t j = 0; j < cols; ++j) {
-                    result[i][j] = static_cast<MULTIPLY_T(T, U)>(this->get(i, j)) * static_cast<MULTIPLY_T(T, U)>(n);
-                }
-            }
-            return result;
+        LUDecomposition<Real, rows> decompose() const {
+            static_assert(rows == cols, "Attempting to decompose nonsquare matrix.");
+            return LUDecomposition<Real, rows>(*this);
         }
 
         /**
 
-        @brief Multiplication operator between two matrices.
+        @return The vector x such that (*this)x = @param b.
+        @warning Only usable with with square matrices.
 
         */
 
-        template <typename U, size_t bCols>
-        auto operator*(const Matrix<U, cols, bCols> &b) const -> Matrix<MULTIPLY_T(T, U), rows, bCols> {
-            Matrix<MULTIPLY_T(T, U), rows, bCols> result;
-            for (size_t i = 0; i < rows; ++i) {
-                Vector<T, cols> lVec = this->getRow(i);
-                Vector<MULTIPLY_T(T, U), bCols> resultVec;
-                for (size_t j = 0; j < b.numCols(); ++j) {
-                    resultVec[j] = lVec * b.getCol(j);
-                }
-                result[i] = resultVec;
-            }
-            return result;
+        template <typename E>
+        Vector<Real, rows> solve(const VectorExpression<E> &b) const {
+            return decompose().solve(b);
         }
 
-        template <typename U>
-        auto operator()(const Matrix<U, rows, cols> &b) const -> Matrix<MULTIPLY_T(T, U), rows, cols> {
+        template <typename U, typename L>
+        auto operator()(const Matrix<U, rows, cols, L> &b) const -> Matrix<MULTIPLY_T(T, U), rows, cols> {
             Matrix<MULTIPLY_T(T, U), rows, cols> result = (*this);
             for (size_t i = 0; i < rows; ++i) {
                 for (size_t j = 0; j < cols; ++j) {
-                    result[i][j] *= b.getRow(i)[j];
+                    result[i][j] *= b.get(i, j);
                 }
             }
             return result;
@@ -428,45 +427,30 @@ namespace jml {
 
         /**
 
-        @brief Multiplication operator between matrix and vector.
-
-        */
-
-        template <typename U>
-        auto operator*(const Vector<U, cols> &v) const -> Vector<MULTIPLY_T(T, U), rows> {
-            Vector<MULTIPLY_T(T, U), rows> result;
-            for (size_t i = 0; i < rows; ++i) {
-                Vector<U, cols> row = getRow(i);
-                result[i] = row * v;
-            }
-            return result;
-        }
-
-        /**
-
         @brief Division operator between two matrices.
 
         */
 
-        template <typename U>
-        auto operator/(const Matrix<U, rows, cols> &m) const -> Matrix<long double, rows, cols> {
+        template <typename U, typename L>
+        auto operator/(const Matrix<U, rows, cols, L> &m) const -> Matrix<Real, rows, cols> {
             static_assert(rows == cols, "Attempting to divide nonsquare matrices.");
-            Matrix<long double, rows, cols> result = *this;
+            Matrix<Real, rows, cols> result = *this;
             result = (*this) * m.inverse();
             return result;
         }
 
         /**
 
-        @brief Assignment operator between two matrices.
+        @brief Assignment operator between the matrix and a matrix, view or expression.
+        The expression is evaluated before any element is written, so it may refer to the matrix itself.
 
         */
 
-        template <typename U>
-        auto operator=(const Matrix<U, rows, cols> &b) -> Matrix<T, rows, cols>& {
-            for (size_t i = 0; i < rows; ++i) {
-                (*this)[i] = static_cast<Vector<T, cols> >(b.getRow(i));
-            }
+        template <typename E>
+        auto operator=(const MatrixExpression<E> &m) -> Matrix<T, rows, cols, Layout>& {
+            static_assert(E::nRows == rows && E::nCols == cols, "Assigning expression of mismatched size to matrix.");
+            Matrix<T, rows, cols, Layout> result(m);
+            *this = result;
             return *this;
         }
 
@@ -476,11 +460,13 @@ namespace jml {
 
         */
 
-        template <typename U>
-        operator Matrix<U, rows, cols>() const {
-            Matrix<U, rows, cols> result;
+        template <typename U, typename L>
+        operator Matrix<U, rows, cols, L>() const {
+            Matrix<U, rows, cols, L> result;
             for (size_t i = 0; i < rows; ++i) {
-                result[i] = static_cast<Vector<U, cols> >(this->getRow(i));
+                for (size_t j = 0; j < cols; ++j) {
+                    result[i][j] = static_cast<U>(get(i, j));
+                }
             }
             return result;
         }
@@ -496,19 +482,91 @@ namespace jml {
 
 
     private:
-        jutil::Queue<Vector<T, cols> > data;
+        T rawMatrix[rows * cols];
+
+        static constexpr size_t rowStride() {
+            return Layout::rowStride(rows, cols);
+        }
+
+        static constexpr size_t colStride() {
+            return Layout::colStride(rows, cols);
+        }
+
+        static constexpr size_t index(size_t x, size_t y) {
+            return x * rowStride() + y * colStride();
+        }
+
+        T &at(size_t x, size_t y) {
+            return rawMatrix[index(x, y)];
+        }
+
+        void fill(const T &n) {
+            for (size_t i = 0; i < rows * cols; ++i) {
+                rawMatrix[i] = n;
+            }
+        }
+
+        ///Square matrices up to 4x4 use the closed forms in closedform.h, and larger ones an LU decomposition.
+        Real determinant(_Choose<true>) const {
+            Real m[rows * cols];
+            rowMajor(m);
+            return jml::determinant(m);
+        }
 
-        void populateRows(const T &n) {
-            data.clear();
-            data.reserve(rows);
+        Real determinant(_Choose<false>) const {
+            return decompose().determinant();
+        }
+
+        Matrix<Real, rows, cols> inverse(_Choose<true>) const {
+            Real m[rows * cols], r[rows * cols];
+            rowMajor(m);
+            jml::inverse(m, r);
+            Matrix<Real, rows, cols> result;
+            for (size_t i = 0; i < rows * cols; ++i) {
+                result.data()[i] = r[i];
+            }
+            return result;
+        }
+
+        Matrix<Real, rows, cols> inverse(_Choose<false>) const {
+            return decompose().inverse();
+        }
+
+        ///@return The transformation with linear part @param r (row-major 3x3) and translation -r * t, where t is this matrix's translation.
+        Matrix<Real, rows, cols> composeInverse(const Real (&r)[9]) const {
+            Real t[3] = {static_cast<Real>(get(0, 3)), static_cast<Real>(get(1, 3)), static_cast<Real>(get(2, 3))};
+            Matrix<Real, rows, cols> result;
+            for (size_t i = 0; i < 3; ++i) {
+                result[i][0] = r[i * 3];
+                result[i][1] = r[i * 3 + 1];
+                result[i][2] = r[i * 3 + 2];
+                result[i][3] = -(r[i * 3] * t[0] + r[i * 3 + 1] * t[1] + r[i * 3 + 2] * t[2]);
+            }
+            result[3][3] = 1;
+            return result;
+        }
+
+        template <typename U>
+        void rowMajor(U *arr) const {
+            for (size_t i = 0; i < rows; ++i) {
+                for (size_t j = 0; j < cols; ++j) {
+                    arr[i * cols + j] = static_cast<U>(get(i, j));
+                }
+            }
+        }
+
+        template <typename M>
+        void copy(const M &m) {
             for (size_t i = 0; i < rows; ++i) {
-                data.insert(Vector<T, cols>(n));
+                for (size_t j = 0; j < cols; ++j) {
+                    at(i, j) = static_cast<T>(m.get(i, j));
+                }
             }
         }
 
         jutil::String asString() const {
             jutil::String r;
-            for (auto &i: data) {
+            for (auto i: *this) {
                 for (auto &ii: i) {
                     r += jutil::String(ii) + jutil::String('\t');
                 }
@@ -566,28 +624,59 @@ namespace jml {
     typedef Matrix<uint64_t, 3, 3> Matrix3u64;
     typedef Matrix<uint64_t, 4, 4> Matrix4u64;
 
-    using Transformation = Matrix<long double, 4, 4>;
+    /**
+
+    @brief Vectorized products for the row-major 4x4 floating point matrices. @see simd.h
+    These are templates only so that they are never reached through an implicit conversion from another matrix type.
+
+    */
+
+    template <typename X>
+    inline Vector4f operator*(const Matrix<float, 4, 4, RowMajor, X> &m, const Vector<float, 4, X> &v) {
+        Vector4f result;
+        _mulMat4Vec4(m.data(), v.data(), result.data());
+        return result;
+    }
+
+    template <typename X>
+    inline Vector4d operator*(const Matrix<double, 4, 4, RowMajor, X> &m, const Vector<double, 4, X> &v) {
+        Vector4d result;
+        _mulMat4Vec4(m.data(), v.data(), result.data());
+        return result;
+    }
+
+    template <typename X>
+    inline Matrix4f operator*(const Matrix<float, 4, 4, RowMajor, X> &a, const Matrix<float, 4, 4, RowMajor, X> &b) {
+        Matrix4f result;
+        _mulMat4Mat4(a.data(), b.data(), result.data());
+        return result;
+    }
+
+    template <typename X>
+    inline Matrix4d operator*(const Matrix<double, 4, 4, RowMajor, X> &a, const Matrix<double, 4, 4, RowMajor, X> &b) {
+        Matrix4d result;
+        _mulMat4Mat4(a.data(), b.data(), result.data());
+        return result;
+    }
+
+    using Transformation = Matrix<Real, 4, 4>;
 
     template<typename U, size_t size>
     inline Matrix<U, size, size> identity() {
         Matrix<U, size, size> result;
         for (size_t i = 0; i < size; ++i) {
-            Vector<U, size> resultVec;
-            resultVec[i] = static_cast<U>(1);
-            result[i] = resultVec;
+            result[i][i] = static_cast<U>(1);
         }
         return result;
     }
 
+    ///@return @param m times the translation by @param v, which only changes the last column of m, to m (v, 1). @see Affine.h
     inline Transformation translate(const Vertex &v, const Transformation &m) {
-        Transformation t = {
-            {1, 0, 0, v[0]},
-            {0, 1, 0, v[1]},
-            {0, 0, 1, v[2]},
-            {0, 0, 0, 1},
-        };
-
-        return m * t;
+        Transformation result = m;
+        for (size_t i = 0; i < 4; ++i) {
+            result[i][3] = m[i][0] * v[0] + m[i][1] * v[1] + m[i][2] * v[2] + m[i][3];
+        }
+        return result;
     }
 
     inline Transformation scale(const Vertex &v, const Transformation &m) {
@@ -598,49 +687,122 @@ namespace jml {
         return t;
     }
 
+    ///@return @param m times the rotation whose upper-left 3x3 block is @param r, which only touches the first three columns of m.
+    inline Transformation _rotate(const Real (&r)[3][3], const Transformation &m) {
+        Transformation result = m;
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                result[i][j] = m[i][0] * r[0][j] + m[i][1] * r[1][j] + m[i][2] * r[2][j];
+            }
+        }
+        return result;
+    }
+
+    /**
+
+    @brief Rotates @param m by @param a times @param axes[i] about each axis i, first about x, then y, then z.
+    The product of the three rotations is written out in closed form, and axes which are 0 cost no trigonometry.
+    @see Quaternion.h for rotations which are composed or interpolated before they are applied.
+
+    */
+
     inline Transformation rotate(const Angle &a, const Vector<int8_t, 3> &axes, const Transformation &m) {
-        long double k[] = {Angle::radians(a) * axes[0], Angle::radians(a) * axes[1], Angle::radians(a) * axes[2]};
-        Transformation x = {
-            {1, 0, 0, 0},
-            {0, cos(k[0]), -sin(k[0]), 0},
-            {0, sin(k[0]), cos(k[0]), 0},
-            {0, 0, 0, 1}
+        Real s[3], c[3];
+        for (size_t i = 0; i < 3; ++i) {
+            if (axes[i] == 0) {
+                s[i] = 0;
+                c[i] = 1;
+            } else if (axes[i] == 1) {
+                sincos(a, s[i], c[i]);
+            } else {
+                sincos(Angle::radians(a) * axes[i], s[i], c[i]);
+            }
+        }
+        const Real r[3][3] = {
+            {c[2] * c[1], c[2] * s[1] * s[0] - s[2] * c[0], c[2] * s[1] * c[0] + s[2] * s[0]},
+            {s[2] * c[1], s[2] * s[1] * s[0] + c[2] * c[0], s[2] * s[1] * c[0] - c[2] * s[0]},
+            {-s[1], c[1] * s[0], c[1] * c[0]}
         };
+        return _rotate(r, m);
+    }
 
-        Transformation y = {
-            {cos(k[1]), 0, sin(k[1]), 0},
-            {0, 1, 0, 0},
-            {-sin(k[1]), 0, cos(k[1]), 0},
-            {0, 0, 0, 1}
-        };
+    /**
 
-        Transformation z = {
-            {cos(k[2]), -sin(k[2]), 0, 0},
-            {sin(k[2]), cos(k[2]), 0, 0},
-            {0, 0, 1, 0},
-            {0, 0, 0, 1}
-        };
+    @brief Orthographic projection of the box [ @param l, @param r ] x [ @param b, @param t ] x [ -@param n, -@param f ] onto the cube [-1, 1]^3.
+    Like translate(), it acts on column vectors, so the translation is in the last column.
 
-        return m * (z * y * x);
+    */
+
+    inline Transformation ortho(Real l, Real r, Real b, Real t, Real n, Real f) {
+        Transformation result = identity<Real, 4>();
+        result[0][0] = 2 / (r - l);
+        result[1][1] = 2 / (t - b);
+        result[2][2] = -(2 / (f - n));
+        result[0][3] = -((r + l) / (r - l));
+        result[1][3] = -((t + b) / (t - b));
+        result[2][3] = -((f + n) / (f - n));
+        return result;
+    }
+
+    /**
+
+    @brief Perspective projection with the vertical field of view @param fovy and the width to height ratio @param aspect,
+    looking down -z, which maps the depths -@param n and -@param f to -1 and 1 after the division by w.
+
+    */
+
+    inline Transformation perspective(const Angle &fovy, Real aspect, Real n, Real f) {
+        Real s, c;
+        sincos(Angle(Angle::radians(fovy) / 2), s, c);
+        Real k = c / s;
+        Transformation result;
+        result[0][0] = k / aspect;
+        result[1][1] = k;
+        result[2][2] = (f + n) / (n - f);
+        result[2][3] = 2 * f * n / (n - f);
+        result[3][2] = -1;
+        return result;
     }
 
-    inline Transformation ortho(long double l, long double r, long double b, long double t, long double n, long double f) {
-        Transformation result = identity<long double, 4>();
-        result[0][0] = 2.0L / (r - l);
-        result[1][1] = 2.0L / (t - b);
-        result[2][2] = -(2.0L / (f - n));
-        result[3][0] = -((r + l) / (r - l));
-        result[3][1] = -((t + b) / (t - b));
-        result[3][2] = -((f + n) / (f - n));
+    /**
+
+    @brief View transform of a camera at @param eye looking at @param center, with @param up towards the top of the view.
+    The camera looks down -z, with x to its right and y up. Only the x, y and z of the vertices are read.
+
+    */
+
+    inline Transformation lookAt(const Vertex &eye, const Vertex &center, const Vertex &up) {
+        Real fw[3] = {center[0] - eye[0], center[1] - eye[1], center[2] - eye[2]};
+        Real k = rsqrt(fw[0] * fw[0] + fw[1] * fw[1] + fw[2] * fw[2]);
+        for (size_t i = 0; i < 3; ++i) {
+            fw[i] *= k;
+        }
+        Real side[3] = {fw[1] * up[2] - fw[2] * up[1], fw[2] * up[0] - fw[0] * up[2], fw[0] * up[1] - fw[1] * up[0]};
+        k = rsqrt(side[0] * side[0] + side[1] * side[1] + side[2] * side[2]);
+        for (size_t i = 0; i < 3; ++i) {
+            side[i] *= k;
+        }
+        Real u[3] = {side[1] * fw[2] - side[2] * fw[1], side[2] * fw[0] - side[0] * fw[2], side[0] * fw[1] - side[1] * fw[0]};
+        Transformation result = {
+            {side[0], side[1], side[2], 0},
+            {u[0], u[1], u[2], 0},
+            {-fw[0], -fw[1], -fw[2], 0},
+            {0, 0, 0, 1}
+        };
+        for (size_t i = 0; i < 3; ++i) {
+            result[i][3] = -(result[i][0] * eye[0] + result[i][1] * eye[1] + result[i][2] * eye[2]);
+        }
         return result;
     }
 
 }
 
-#define JML_MATRIX_APPLY(m, f, ...) for (auto &__jml_ele: m) { \
+#define JML_MATRIX_APPLY(m, f, ...) for (auto &&__jml_ele: m) { \
     for (auto &jml_ele: __jml_ele) {\
         jml_ele = f(__VA_ARGS__);\
     }\
 }
 
+#include <JML/LU.h>
+
 #endif // JML_MATRIX_H
@@ -0,0 +1,401 @@
+#ifndef JML_PRIMITIVES_H
+#define JML_PRIMITIVES_H
+
+/**
+
+@file       Primitives.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements compact segments, rays and lines, templated on the scalar type and with no virtual functions.
+
+Each primitive is two points and nothing else, so it is trivially copyable and takes 2 * dimension * sizeof(T) bytes:
+16 bytes for float and 32 bytes for double in 2D, 24 and 48 bytes in 3D. Arrays of them are flat and can be streamed
+through the cache, or loaded into SIMD registers one coordinate at a time.
+
+Segment2, Ray2 and Line2 decide their predicates with orient2d and cross2d, so they are exact for float and double coordinates.
+Like LineSegment and Ray, they honour endpointIntersectionEnabled() where two primitives meet only at an endpoint.
+Segment3, Ray3 and Line3 provide parametric points and closest point queries.
+
+The Trace classes convert explicitly, dropping all but the first 2 or 3 coordinates.
+
+*/
+
+#include <JML/Trace.h>
+
+namespace jml {
+
+    ///@return -1, 0 or 1 by the sign of @param d.
+    inline int _sign(double d) {
+        return (d > 0) - (d < 0);
+    }
+
+    ///@return Whether @param a and @param b have the same sign and neither is 0.
+    inline bool _sameSide(double a, double b) {
+        return (a > 0 && b > 0) || (a < 0 && b < 0);
+    }
+
+    template <typename T>
+    inline double _cross2d(const Vector<T, 2> &a, const Vector<T, 2> &b, const Vector<T, 2> &c, const Vector<T, 2> &d) {
+        return cross2d(a.x(), a.y(), b.x(), b.y(), c.x(), c.y(), d.x(), d.y());
+    }
+
+    template <typename T>
+    inline bool _samePoint(const Vector<T, 2> &a, const Vector<T, 2> &b) {
+        return a.x() == b.x() && a.y() == b.y();
+    }
+
+    template <typename T>
+    inline double _cross2dValue(const Vector<T, 2> &a, const Vector<T, 2> &b, const Vector<T, 2> &c, const Vector<T, 2> &d) {
+        return _cross2dValue(a.x(), a.y(), b.x(), b.y(), c.x(), c.y(), d.x(), d.y());
+    }
+
+    ///@return Whether @param p lies in the bounding box of @param a and @param b.
+    template <typename T>
+    inline bool _inBox(const Vector<T, 2> &a, const Vector<T, 2> &b, const Vector<T, 2> &p) {
+        return (
+            (a.x() < b.x()? (a.x() <= p.x() && p.x() <= b.x()) : (b.x() <= p.x() && p.x() <= a.x())) &&
+            (a.y() < b.y()? (a.y() <= p.y() && p.y() <= b.y()) : (b.y() <= p.y() && p.y() <= a.y()))
+        );
+    }
+
+    template <typename T>
+    struct Ray2;
+
+    /**
+
+    @brief Segment between the points a and b.
+    @param T: Scalar type of the coordinates.
+
+    */
+
+    template <typename T>
+    struct Segment2 {
+        typedef T type;
+        typedef Vector<T, 2> Point;
+
+        Point a, b;
+
+        Segment2() {}
+        Segment2(const Point &pa, const Point &pb) : a(pa), b(pb) {}
+        template <typename D>
+        explicit Segment2(const Trace<D> &t) : a(t.startingPoint()), b(t.endingPoint()) {}
+
+        Point direction() const {
+            return b - a;
+        }
+
+        ///@return The point a + (b - a) * @param t.
+        Point at(T t) const {
+            return a + (b - a) * t;
+        }
+
+        T length(uint8_t m = JML_SQRT_EXACT) const {
+            return static_cast<T>((b - a).magnitude(m));
+        }
+
+        ///@return Whether @param p lies on the segment, exactly.
+        bool hasPoint(const Point &p) const {
+            if (!endpointIntersectionEnabled() && (_samePoint(p, a) || _samePoint(p, b))) return false;
+            return orient2d(a, b, p) == 0 && _inBox(a, b, p);
+        }
+
+        ///@return Whether the segment meets @param s, exactly.
+        bool intersects(const Segment2 &s) const {
+            if (_samePoint(a, s.a) || _samePoint(a, s.b) || _samePoint(b, s.a) || _samePoint(b, s.b)) return endpointIntersectionEnabled();
+            double o1 = orient2d(a, b, s.a), o2 = orient2d(a, b, s.b), o3 = orient2d(s.a, s.b, a), o4 = orient2d(s.a, s.b, b);
+            //All four vanish only for collinear segments, where a segment of zero length makes just one pair vanish.
+            if (o1 == 0 && o2 == 0 && o3 == 0 && o4 == 0) {
+                return _inBox(a, b, s.a) || _inBox(a, b, s.b) || _inBox(s.a, s.b, a) || _inBox(s.a, s.b, b);
+            }
+            return !_sameSide(o1, o2) && !_sameSide(o3, o4);
+        }
+
+        /**
+
+        @brief Writes a point the segment shares with @param s to @param p.
+        Where the segments overlap, p is an endpoint of the overlap. The point is rounded to T.
+        @return Whether the segments intersect.
+
+        */
+
+        bool intersects(const Segment2 &s, Point &p) const {
+            if (!intersects(s)) return false;
+            double o1 = orient2d(a, b, s.a), o2 = orient2d(a, b, s.b);
+            if (o1 == 0 && o2 == 0) {
+                p = (_inBox(a, b, s.a)? s.a : _inBox(a, b, s.b)? s.b : a);
+            } else {
+                p = s.at(static_cast<T>(s.crossing(*this)));
+            }
+            return true;
+        }
+
+        bool intersects(const Ray2<T> &r) const;
+
+        /**
+
+        @return The parameter t in [0, 1] of the point at(t) where the segment crosses the line of @param s, which must not be parallel.
+        The parameter is accurate to a few units in the last place even for nearly parallel segments.
+
+        */
+
+        double crossing(const Segment2 &s) const {
+            double t = -_cross2dValue(s.a, s.b, s.a, a) / _cross2dValue(s.a, s.b, a, b);
+            return (t < 0? 0 : t > 1? 1 : t);
+        }
+    };
+
+    /**
+
+    @brief Ray from the point origin through the point through.
+    The direction is kept as a second point so that the predicates stay exact.
+
+    */
+
+    template <typename T>
+    struct Ray2 {
+        typedef T type;
+        typedef Vector<T, 2> Point;
+
+        Point origin, through;
+
+        Ray2() {}
+        Ray2(const Point &o, const Point &t) : origin(o), through(t) {}
+        template <typename D>
+        explicit Ray2(const Trace<D> &t) : origin(t.startingPoint()), through(t.endingPoint()) {}
+
+        Point direction() const {
+            return through - origin;
+        }
+
+        ///@return The point origin + (through - origin) * @param t.
+        Point at(T t) const {
+            return origin + (through - origin) * t;
+        }
+
+        ///@return Whether @param p lies on the ray, exactly.
+        bool hasPoint(const Point &p) const {
+            if (_samePoint(p, origin)) return endpointIntersectionEnabled();
+            return orient2d(origin, through, p) == 0 && ahead(p);
+        }
+
+        ///@return Whether the ray meets @param s, exactly.
+        bool intersects(const Segment2<T> &s) const {
+            if (_samePoint(origin, s.a) || _samePoint(origin, s.b)) return endpointIntersectionEnabled();
+            double o1 = orient2d(origin, through, s.a), o2 = orient2d(origin, through, s.b);
+            if (o1 == 0 && o2 == 0) {
+                return ahead(s.a) || ahead(s.b);
+            }
+            if (_sameSide(o1, o2)) return false;
+            //The side of the segment's line changes linearly along the ray, at the rate cross(s.b - s.a, through - origin).
+            double q = orient2d(s.a, s.b, origin);
+            if (q == 0) return endpointIntersectionEnabled();
+            return _sign(q) == -_sign(_cross2d(s.a, s.b, origin, through));
+        }
+
+        ///@return Whether the ray meets @param r, exactly.
+        bool intersects(const Ray2 &r) const {
+            if (_samePoint(origin, r.origin)) return endpointIntersectionEnabled();
+            double c = _cross2d(origin, through, r.origin, r.through);
+            if (c == 0) {
+                if (orient2d(origin, through, r.origin) != 0) return false;
+                return ahead(r.origin) || r.ahead(origin);
+            }
+            double q1 = orient2d(r.origin, r.through, origin), q2 = orient2d(origin, through, r.origin);
+            if ((q1 != 0 && _sign(q1) != _sign(c)) || (q2 != 0 && _sign(q2) != -_sign(c))) return false;
+            return (q1 == 0 || q2 == 0? endpointIntersectionEnabled() : true);
+        }
+
+    private:
+        ///@return Whether the point @param p, collinear with the ray, lies strictly ahead of the origin.
+        bool ahead(const Point &p) const {
+            if (origin.x() != through.x()) {
+                return (origin.x() < through.x()? p.x() > origin.x() : p.x() < origin.x());
+            }
+            return (origin.y() < through.y()? p.y() > origin.y() : p.y() < origin.y());
+        }
+    };
+
+    template <typename T>
+    inline bool Segment2<T>::intersects(const Ray2<T> &r) const {
+        return r.intersects(*this);
+    }
+
+    ///Line through the points a and b.
+    template <typename T>
+    struct Line2 {
+        typedef T type;
+        typedef Vector<T, 2> Point;
+
+        Point a, b;
+
+        Line2() {}
+        Line2(const Point &pa, const Point &pb) : a(pa), b(pb) {}
+        template <typename D>
+        explicit Line2(const Trace<D> &t) : a(t.startingPoint()), b(t.endingPoint()) {}
+
+        Point direction() const {
+            return b - a;
+        }
+
+        ///@return The point a + (b - a) * @param t.
+        Point at(T t) const {
+            return a + (b - a) * t;
+        }
+
+        ///@return Positive if @param p is left of the line, negative if right and 0 if on it.
+        double side(const Point &p) const {
+            return orient2d(a, b, p);
+        }
+
+        bool hasPoint(const Point &p) const {
+            return orient2d(a, b, p) == 0;
+        }
+
+        bool parallelTo(const Line2 &l) const {
+            return _cross2d(a, b, l.a, l.b) == 0;
+        }
+
+        bool intersects(const Line2 &l) const {
+            return !parallelTo(l) || hasPoint(l.a);
+        }
+
+        bool intersects(const Segment2<T> &s) const {
+            return !_sameSide(orient2d(a, b, s.a), orient2d(a, b, s.b));
+        }
+
+        bool intersects(const Ray2<T> &r) const {
+            double q = orient2d(a, b, r.origin);
+            return q == 0 || _sign(q) == -_sign(_cross2d(a, b, r.origin, r.through));
+        }
+    };
+
+    ///@return The parameter of the point closest to @param p on the line o + d * t, unclamped.
+    template <typename T>
+    inline T _closestParameter(const Vector<T, 3> &o, const Vector<T, 3> &d, const Vector<T, 3> &p) {
+        T dd = d.x() * d.x() + d.y() * d.y() + d.z() * d.z();
+        if (dd == 0) return static_cast<T>(0);
+        return ((p.x() - o.x()) * d.x() + (p.y() - o.y()) * d.y() + (p.z() - o.z()) * d.z()) / dd;
+    }
+
+    ///Segment between the points a and b in 3D.
+    template <typename T>
+    struct Segment3 {
+        typedef T type;
+        typedef Vector<T, 3> Point;
+
+        Point a, b;
+
+        Segment3() {}
+        Segment3(const Point &pa, const Point &pb) : a(pa), b(pb) {}
+        template <typename D>
+        explicit Segment3(const Trace<D> &t) : a(t.startingPoint()), b(t.endingPoint()) {}
+
+        Point direction() const {
+            return b - a;
+        }
+
+        Point at(T t) const {
+            return a + (b - a) * t;
+        }
+
+        T length(uint8_t m = JML_SQRT_EXACT) const {
+            return static_cast<T>((b - a).magnitude(m));
+        }
+
+        ///@return The parameter in [0, 1] of the point of the segment closest to @param p.
+        T closestParameter(const Point &p) const {
+            T t = _closestParameter<T>(a, b - a, p);
+            return (t < 0? static_cast<T>(0) : t > 1? static_cast<T>(1) : t);
+        }
+
+        Point closestPoint(const Point &p) const {
+            return at(closestParameter(p));
+        }
+
+        T distanceSquared(const Point &p) const {
+            return static_cast<T>((closestPoint(p) - p).magnitudeSquared());
+        }
+    };
+
+    ///Ray from the point origin in the direction direction in 3D.
+    template <typename T>
+    struct Ray3 {
+        typedef T type;
+        typedef Vector<T, 3> Point;
+
+        Point origin, direction;
+
+        Ray3() {}
+        Ray3(const Point &o, const Point &d) : origin(o), direction(d) {}
+        template <typename D>
+        explicit Ray3(const Trace<D> &t) : origin(t.startingPoint()), direction(t.endingPoint() - t.startingPoint()) {}
+
+        Point at(T t) const {
+            return origin + direction * t;
+        }
+
+        ///@return The parameter, at least 0, of the point of the ray closest to @param p.
+        T closestParameter(const Point &p) const {
+            T t = _closestParameter<T>(origin, direction, p);
+            return (t < 0? static_cast<T>(0) : t);
+        }
+
+        Point closestPoint(const Point &p) const {
+            return at(closestParameter(p));
+        }
+
+        T distanceSquared(const Point &p) const {
+            return static_cast<T>((closestPoint(p) - p).magnitudeSquared());
+        }
+    };
+
+    ///Line through the point origin in the direction direction in 3D.
+    template <typename T>
+    struct Line3 {
+        typedef T type;
+        typedef Vector<T, 3> Point;
+
+        Point origin, direction;
+
+        Line3() {}
+        Line3(const Point &o, const Point &d) : origin(o), direction(d) {}
+        template <typename D>
+        explicit Line3(const Trace<D> &t) : origin(t.startingPoint()), direction(t.endingPoint() - t.startingPoint()) {}
+
+        Point at(T t) const {
+            return origin + direction * t;
+        }
+
+        T closestParameter(const Point &p) const {
+            return _closestParameter<T>(origin, direction, p);
+        }
+
+        Point closestPoint(const Point &p) const {
+            return at(closestParameter(p));
+        }
+
+        T distanceSquared(const Point &p) const {
+            return static_cast<T>((closestPoint(p) - p).magnitudeSquared());
+        }
+    };
+
+    ///typedefs
+    typedef Segment2<float> Segment2f;
+    typedef Segment2<double> Segment2d;
+    typedef Ray2<float> Ray2f;
+    typedef Ray2<double> Ray2d;
+    typedef Line2<float> Line2f;
+    typedef Line2<double> Line2d;
+
+    typedef Segment3<float> Segment3f;
+    typedef Segment3<double> Segment3d;
+    typedef Ray3<float> Ray3f;
+    typedef Ray3<double> Ray3d;
+    typedef Line3<float> Line3f;
+    typedef Line3<double> Line3d;
+}
+
+#endif // JML_PRIMITIVES_H
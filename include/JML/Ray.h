@@ -53,7 +53,9 @@ namespace jml {
 
         bool hasPoint(const Vertex &p) const {
             if (endpointIntersectionEnabled() && p == vA) return true;
-            return (compare(static_cast<long double>(angle()), static_cast<long double>(Ray(vA, p).angle())) == JML_EQUAL);
+            //Same direction, compared by pseudo-angle so that no atan2 is needed.
+            Vertex d = vB - vA, e = p - vA;
+            return (compare(pseudoAngle(d.y(), d.x()), pseudoAngle(e.y(), e.x())) == JML_EQUAL);
         }
 
         Angle angle() const {
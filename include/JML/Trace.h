@@ -15,14 +15,11 @@ namespace jml {
         Trace(const Trace<O> &t) : vA(t.vA), vB(t.vB) {}
 
         template <typename O>
-        D &operator=(const Trace<O> &t) {vA = t.vA; vB = t.vB;}
+        D &operator=(const Trace<O> &t) {vA = t.vA; vB = t.vB; return static_cast<D&>(*this);}
 
-        virtual bool hasPoint(const Vertex&) const = 0;
-        virtual bool intersects(const D&) const = 0;
-
-        long double slope() const {
-            long double num = (abs(vB.y() - vA.y()) > JML_EPSILON? (vB.y() - vA.y()) : JML_EPSILON / 10.L);
-            long double den = (abs(vB.x() - vA.x()) > JML_EPSILON? (vB.x() - vA.x()) : JML_EPSILON / 10.L);
+        Real slope() const {
+            Real num = (abs(vB.y() - vA.y()) > JML_EPSILON? (vB.y() - vA.y()) : static_cast<Real>(JML_EPSILON / 10.L));
+            Real den = (abs(vB.x() - vA.x()) > JML_EPSILON? (vB.x() - vA.x()) : static_cast<Real>(JML_EPSILON / 10.L));
             return num / den;
         }
 
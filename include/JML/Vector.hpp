@@ -13,44 +13,41 @@ Implements a Vector class designed to mimic the behaviour of mathematical Vector
 
 */
 
-#include <JML/functions.h>
+#include <JML/View.h>
+#include <JML/simd.h>
+#include <JML/predicates.h>
 
 namespace jml {
 
-    ///Forward-declare Matrix. @see Matrix.hpp
-    template<
-        typename T,
-        size_t rows,
-        size_t cols,
-        typename = typename jutil::Enable<jutil::IsArithmatic<T>::Value>::Type
-    >
-    class Matrix;
-
     /**
 
     @param T: Base numerical type to be stored in the vector.
     @param length: Number of elements in the vector.
 
+    Elements are stored inline, so vectors never allocate and copy as plain data.
+
     */
 
     template<
         typename T,
         size_t length,
-        typename = typename jutil::Enable<jutil::IsArithmatic<T>::Value>::Type
+        typename
     >
-    class Vector : public jutil::StringInterface {
+    class Vector : public VectorExpression<Vector<T, length> > {
 
     public:
 
+        static constexpr size_t nLength = length;
+
         typedef std::initializer_list<T> Literal;
-        typedef jutil::Queue<T> Raw;
+        typedef T Raw[length];
         typedef T* Iterator;
         typedef const T* ConstIterator;
         typedef T type;
 
         template <typename U>
-        long double angleTo(const Vector<U, length> &other) const {
-            return (*this * other) / (magnitude() * other.magnitude());
+        Real angleTo(const Vector<U, length> &other) const {
+            return (*this * other) / (this->magnitude() * other.magnitude());
         }
 
         /**
@@ -122,14 +119,27 @@ namespace jml {
 
         /**
 
+        @return Pointer to the vector's contiguous element storage.
+
+        */
+
+        T *data() {
+            return rawVector;
+        }
+
+        const T *data() const {
+            return rawVector;
+        }
+
+        /**
+
         @brief Constrcutor which sets all elements to 0.
 
         */
 
         Vector() {
-            rawVector.reserve(length);
             for (size_t i = 0; i < length; ++i) {
-                rawVector.insert(static_cast<T>(0));
+                rawVector[i] = static_cast<T>(0);
             }
         }
 
@@ -140,14 +150,7 @@ namespace jml {
         */
 
         Vector(Literal v) {
-            rawVector.reserve(length);
-            for (size_t i = 0; i < length; ++i) {
-                if (i < v.size()) {
-                    rawVector.insert(static_cast<T>(*(v.begin() + i)));
-                } else if (i >= v.size()) {
-                    rawVector.insert(static_cast<T>(0));
-                }
-            }
+            assign(v);
         }
 
         /**
@@ -157,56 +160,36 @@ namespace jml {
         */
 
         Vector(T n) {
-            rawVector.reserve(length);
             for (size_t i = 0; i < length; ++i) {
-                rawVector.insert(n);
+                rawVector[i] = n;
             }
         }
 
         /**
 
-        @brief Copy constrctor.
+        @brief Constructor which evaluates the vector, view or expression @param v, then fills any remaining elements with @param args.
         */
 
         template <
-            typename U,
-            size_t len,
+            typename E,
             typename... Args,
-            typename = typename jutil::Enable<jutil::Convert<U, T>::Value>::Type
+            typename = typename jutil::Enable<jutil::Convert<typename E::type, T>::Value>::Type
         >
-        Vector(const Vector<U, len> &v, const Args... args) {
-            rawVector.reserve(length);
-            T arr[] = {static_cast<T>(args)...};
+        Vector(const VectorExpression<E> &v, const Args... args) {
+            constexpr size_t len = E::nLength;
+            const E &e = v.self();
+            T arr[] = {static_cast<T>(args)..., static_cast<T>(0)};
             for (size_t i = 0; i < length; ++i) {
                 if (i < len) {
-                    rawVector.insert(static_cast<T>(v.get(i)));
+                    rawVector[i] = static_cast<T>(e.get(i));
+                } else if (i - len < sizeof...(Args)) {
+                    rawVector[i] = arr[i - len];
                 } else {
-                    rawVector.insert(arr[i - len]);
+                    rawVector[i] = static_cast<T>(0);
                 }
             }
         }
 
-        ///@return *this / ||*this||
-        Vector<long double, length> unitForm() const {
-            Vector<long double, length> v;
-            size_t index = 0;
-            for (auto &i: rawVector) {
-                v[index] = (i / magnitude());
-                ++index;
-            }
-            return v;
-        }
-
-        ///@return ||*this||
-        long double magnitude() const {
-            long double r = 0.0L;
-            for (auto &i: rawVector) {
-                r += pow(i, 2);
-            }
-            long double s = static_cast<long double>(sqrtf(static_cast<float>(r)));
-            return s;
-        }
-
         /**
 
         @return Pointer to the first element in the vector.
@@ -249,88 +232,16 @@ namespace jml {
 
         /**
 
-        @brief Addition operator between two vectors.
-
-        */
-
-        template <typename U>
-        auto operator+(const Vector<U, length> &b) const -> Vector<ADD_T(T, U), length> {
-            typedef Vector<ADD_T(T, U), length> rType;
-            rType result;
-            for (size_t i = 0; i < length; ++i) {
-                result[i] = static_cast<ADD_T(T, U)>(this->get(i)) + static_cast<ADD_T(T, U)>(b.get(i));
-            }
-            return result;
-        }
-
-        /**
-
-        @brief Subtraction operator between two vectors.
-
-        */
-
-        template <typename U>
-        auto operator-(const Vector<U, length> &b) const -> Vector<SUBTRACT_T(T, U), length> {
-            return *this + (b * -1);
-        }
-
-        /**
-
-        @brief Division operator between the vector and a scalar
-
-        */
-
-        template <typename U, typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type>
-        auto operator/(const U &b) const -> Vector<DIVIDE_T(T, U), length> {
-            Vector<DIVIDE_T(T, U), length> result;
-            double m = (1.0d / b);
-            for (size_t i = 0; i < length; ++i) {
-                result[i] = static_cast<DIVIDE_T(T, U)>(this->get(i)) * m;
-            }
-            return result;
-        }
-
-        /**
-
-        @brief Multiplication operator between the vector and a scalar.
+        @brief Assignment operator between the vector and a vector, view or expression.
 
         */
 
-        template<typename U, typename = typename jutil::Enable<jutil::Convert<U, T>::Value>::Type>
-        auto operator*(const U &n) const -> Vector<MULTIPLY_T(T, U), length> {
-            typedef Vector<MULTIPLY_T(T, U), length> rType;
-            rType result;
+        template<typename E>
+        auto operator=(const VectorExpression<E> &v) -> Vector<T, length>& {
+            static_assert(E::nLength == length, "Assigning expression of mismatched length to vector.");
+            const E &e = v.self();
             for (size_t i = 0; i < length; ++i) {
-                result[i] = static_cast<MULTIPLY_T(T, U)>(this->get(i)) * static_cast<MULTIPLY_T(T, U)>(n);
-            }
-            return result;
-        }
-
-        /**
-
-        @brief Multiplication operator between two vectors.
-
-        */
-
-        template <typename U>
-        auto operator*(const Vector<U, length> &b) const -> MULTIPLY_T(T, U) {
-            MULTIPLY_T(T, U) result = static_cast<MULTIPLY_T(T, U)>(0);
-            for (size_t i = 0; i < length; ++i) {
-                result += static_cast<MULTIPLY_T(T, U)>(get(i)) * static_cast<MULTIPLY_T(T, U)>(b.get(i));
-            }
-            return result;
-        }
-
-        /**
-
-        @brief Assignment operator between two vectors.
-
-        */
-
-        template<typename U>
-        auto operator=(const Vector<U, length> &v) -> Vector<T, length> {
-            for (size_t i = 0; i < length; ++i) {
-                (*this)[i] = static_cast<T>(v.get(i));
+                rawVector[i] = static_cast<T>(e.get(i));
             }
             return *this;
         }
@@ -341,15 +252,8 @@ namespace jml {
 
         */
 
-        auto operator=(Literal v) -> Vector<T, length> {
-            rawVector.clear();
-            for (size_t i = 0; i < length; ++i) {
-                if (i < v.size()) {
-                    rawVector.insert(static_cast<T>(*(v.begin() + i)));
-                } else if (i >= v.size()) {
-                    rawVector.insert(static_cast<T>(0));
-                }
-            }
+        auto operator=(Literal v) -> Vector<T, length>& {
+            assign(v);
             return *this;
         }
 
@@ -399,12 +303,16 @@ namespace jml {
 
         */
 
-        template <typename U, size_t rows>
-        auto operator*(const Matrix<U, rows, length> &m) const -> Vector<MULTIPLY_T(T, U), rows> {
-            Vector<MULTIPLY_T(T, U), rows> result;
+        template <typename U, size_t rows, typename L>
+        auto operator*(const Matrix<U, rows, length, L> &m) const -> Vector<MULTIPLY_T(T, U), rows> {
+            typedef MULTIPLY_T(T, U) R;
+            Vector<R, rows> result;
             for (size_t i = 0; i < rows; ++i) {
-                Vector<U, length> row = m.getRow(i);
-                result[i] = row * (*this);
+                R sum = static_cast<R>(0);
+                for (size_t j = 0; j < length; ++j) {
+                    sum += static_cast<R>(m.get(i, j)) * static_cast<R>(rawVector[j]);
+                }
+                result[i] = sum;
             }
             return result;
         }
@@ -419,6 +327,17 @@ namespace jml {
 
         private:
         Raw rawVector;
+
+        void assign(Literal v) {
+            for (size_t i = 0; i < length; ++i) {
+                if (i < v.size()) {
+                    rawVector[i] = static_cast<T>(*(v.begin() + i));
+                } else {
+                    rawVector[i] = static_cast<T>(0);
+                }
+            }
+        }
+
         jutil::String asString() const {
             jutil::String r = "[";
             for (auto &i: *this) {
@@ -484,20 +403,40 @@ namespace jml {
     typedef Vector<uint64_t, 3> Vector3u64;
     typedef Vector<uint64_t, 4> Vector4u64;
 
-    using Vertex = Vector<long double, 4>;
+    /**
+
+    @brief Vectorized dot products for the 4-wide floating point vectors. @see simd.h
+    These are templates only so that they are never reached through an implicit conversion from another vector type.
+
+    */
+
+    template <typename X>
+    inline float operator*(const Vector<float, 4, X> &a, const Vector<float, 4, X> &b) {
+        return _dot4(a.data(), b.data());
+    }
+
+    template <typename X>
+    inline double operator*(const Vector<double, 4, X> &a, const Vector<double, 4, X> &b) {
+        return _dot4(a.data(), b.data());
+    }
+
+    using Vertex = Vector<Real, 4>;
 
+    ///@return Distance between @param a and @param b, with the square root taken in the mode @param m.
     template <typename T, size_t l>
-    inline long double distance(const Vector<T, l> &a, const Vector<T, l> &b) {
-        long double r = 0;
+    inline Real distance(const Vector<T, l> &a, const Vector<T, l> &b, uint8_t m = JML_SQRT_EXACT) {
+        Real r = 0;
         for (size_t i = 0; i < l; ++i) {
-            r += (jml::pow(b[i] - a[i], 2));
+            Real d = static_cast<Real>(b[i] - a[i]);
+            r += d * d;
         }
-        return sqrt(r);
+        return sqrt(r, m);
     }
 
+    ///@return Orientation of @param p1, @param p2, @param p3 in the xy plane, decided exactly by orient2d().
     inline int8_t ccw(const Vertex &p1, const Vertex &p2, const Vertex &p3) {
-        long double r = ((p2.x() - p1.x()) * (p3.y() - p1.y())) - ((p2.y() - p1.y()) * (p3.x() - p1.x()));
-        return compare(r, 0.L);
+        double r = orient2d(p1, p2, p3);
+        return (r > 0? JML_COUNTERCLOCKWISE : r < 0? JML_CLOCKWISE : JML_COLLINEAR);
     }
 }
 
@@ -0,0 +1,278 @@
+#ifndef JML_VERTEX_BUFFER_H
+#define JML_VERTEX_BUFFER_H
+
+/**
+
+@file       VertexBuffer.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements a structure-of-arrays container of 4-component vertices, along with a batched kernel which applies a Transformation to every vertex in it.
+
+Define JML_THREADS to enable the overload of transform() which splits the work across threads.
+
+*/
+
+#include <JML/Matrix.h>
+
+#ifdef JML_THREADS
+    #include <thread>
+#endif
+
+namespace jml {
+
+    /**
+
+    @brief Stores vertices as four separate arrays of x, y, z and w components, so that they can be streamed through SIMD registers.
+    @param T: Scalar type of each component.
+
+    */
+
+    template <typename T>
+    class VertexBuffer {
+    public:
+
+        typedef Vector<T, 4> VertexType;
+
+        VertexBuffer() {}
+
+        ///@brief Constructor which creates @param n vertices at the origin, with w = 1.
+        VertexBuffer(size_t n) {
+            resize(n);
+        }
+
+        ///@return Number of vertices in the buffer.
+        size_t size() const {
+            return xs.size();
+        }
+
+        void reserve(size_t n) {
+            xs.reserve(n);
+            ys.reserve(n);
+            zs.reserve(n);
+            ws.reserve(n);
+        }
+
+        ///@brief Grows the buffer to @param n vertices, filling new ones with the origin and w = 1. Never shrinks.
+        void resize(size_t n) {
+            reserve(n);
+            while (size() < n) {
+                insert(VertexType({0, 0, 0, 1}));
+            }
+        }
+
+        void clear() {
+            xs.clear();
+            ys.clear();
+            zs.clear();
+            ws.clear();
+        }
+
+        ///@brief Appends the vertex @param v.
+        template <typename E>
+        VertexBuffer &insert(const VectorExpression<E> &v) {
+            static_assert(E::nLength == 4, "Inserting vector of length other than 4 into vertex buffer.");
+            const E &e = v.self();
+            xs.insert(static_cast<T>(e.get(0)));
+            ys.insert(static_cast<T>(e.get(1)));
+            zs.insert(static_cast<T>(e.get(2)));
+            ws.insert(static_cast<T>(e.get(3)));
+            return *this;
+        }
+
+        ///@return Copy of the vertex at index @param i.
+        VertexType get(size_t i) const {
+            return VertexType({xs[i], ys[i], zs[i], ws[i]});
+        }
+
+        ///@brief Overwrites the vertex at index @param i with @param v.
+        template <typename E>
+        void set(size_t i, const VectorExpression<E> &v) {
+            static_assert(E::nLength == 4, "Storing vector of length other than 4 in vertex buffer.");
+            const E &e = v.self();
+            xs[i] = static_cast<T>(e.get(0));
+            ys[i] = static_cast<T>(e.get(1));
+            zs[i] = static_cast<T>(e.get(2));
+            ws[i] = static_cast<T>(e.get(3));
+        }
+
+        /**
+
+        @return Pointers to the contiguous arrays of each component.
+        @warning Invalidated by any operation which adds vertices.
+
+        */
+
+        T *x() {return xs.begin();}
+        T *y() {return ys.begin();}
+        T *z() {return zs.begin();}
+        T *w() {return ws.begin();}
+
+        const T *x() const {return xs.begin();}
+        const T *y() const {return ys.begin();}
+        const T *z() const {return zs.begin();}
+        const T *w() const {return ws.begin();}
+
+    private:
+        jutil::Queue<T> xs, ys, zs, ws;
+    };
+
+    /**
+
+    @brief Applies the row-major 4x4 matrix @param m to vertices [ @param b, @param e ) of the component arrays @param x, @param y, @param z and @param w, in place.
+    Sums are paired the same way in every variant, so a vertex's result does not depend on whether it was reached by a SIMD loop or a scalar tail.
+
+    */
+
+    template <typename T>
+    inline void _transformSoA(const T (&m)[16], T *x, T *y, T *z, T *w, size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+            T vx = x[i], vy = y[i], vz = z[i], vw = w[i];
+            x[i] = (m[0] * vx + m[1] * vy) + (m[2] * vz + m[3] * vw);
+            y[i] = (m[4] * vx + m[5] * vy) + (m[6] * vz + m[7] * vw);
+            z[i] = (m[8] * vx + m[9] * vy) + (m[10] * vz + m[11] * vw);
+            w[i] = (m[12] * vx + m[13] * vy) + (m[14] * vz + m[15] * vw);
+        }
+    }
+
+    #if defined(JML_AVX)
+
+    inline void _transformSoA(const float (&m)[16], float *x, float *y, float *z, float *w, size_t b, size_t e) {
+        __m256 c[16];
+        for (size_t i = 0; i < 16; ++i) {
+            c[i] = _mm256_set1_ps(m[i]);
+        }
+        size_t i = b;
+        for (; i + 8 <= e; i += 8) {
+            __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i), vw = _mm256_loadu_ps(w + i);
+            for (size_t r = 0; r < 4; ++r) {
+                __m256 o = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(c[r * 4], vx), _mm256_mul_ps(c[r * 4 + 1], vy)),
+                    _mm256_add_ps(_mm256_mul_ps(c[r * 4 + 2], vz), _mm256_mul_ps(c[r * 4 + 3], vw))
+                );
+                _mm256_storeu_ps((r == 0? x : r == 1? y : r == 2? z : w) + i, o);
+            }
+        }
+        _transformSoA<float>(m, x, y, z, w, i, e);
+    }
+
+    inline void _transformSoA(const double (&m)[16], double *x, double *y, double *z, double *w, size_t b, size_t e) {
+        __m256d c[16];
+        for (size_t i = 0; i < 16; ++i) {
+            c[i] = _mm256_set1_pd(m[i]);
+        }
+        size_t i = b;
+        for (; i + 4 <= e; i += 4) {
+            __m256d vx = _mm256_loadu_pd(x + i), vy = _mm256_loadu_pd(y + i), vz = _mm256_loadu_pd(z + i), vw = _mm256_loadu_pd(w + i);
+            for (size_t r = 0; r < 4; ++r) {
+                __m256d o = _mm256_add_pd(
+                    _mm256_add_pd(_mm256_mul_pd(c[r * 4], vx), _mm256_mul_pd(c[r * 4 + 1], vy)),
+                    _mm256_add_pd(_mm256_mul_pd(c[r * 4 + 2], vz), _mm256_mul_pd(c[r * 4 + 3], vw))
+                );
+                _mm256_storeu_pd((r == 0? x : r == 1? y : r == 2? z : w) + i, o);
+            }
+        }
+        _transformSoA<double>(m, x, y, z, w, i, e);
+    }
+
+    #elif defined(JML_SSE2)
+
+    inline void _transformSoA(const float (&m)[16], float *x, float *y, float *z, float *w, size_t b, size_t e) {
+        __m128 c[16];
+        for (size_t i = 0; i < 16; ++i) {
+            c[i] = _mm_set1_ps(m[i]);
+        }
+        size_t i = b;
+        for (; i + 4 <= e; i += 4) {
+            __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i), vw = _mm_loadu_ps(w + i);
+            for (size_t r = 0; r < 4; ++r) {
+                __m128 o = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(c[r * 4], vx), _mm_mul_ps(c[r * 4 + 1], vy)),
+                    _mm_add_ps(_mm_mul_ps(c[r * 4 + 2], vz), _mm_mul_ps(c[r * 4 + 3], vw))
+                );
+                _mm_storeu_ps((r == 0? x : r == 1? y : r == 2? z : w) + i, o);
+            }
+        }
+        _transformSoA<float>(m, x, y, z, w, i, e);
+    }
+
+    inline void _transformSoA(const double (&m)[16], double *x, double *y, double *z, double *w, size_t b, size_t e) {
+        __m128d c[16];
+        for (size_t i = 0; i < 16; ++i) {
+            c[i] = _mm_set1_pd(m[i]);
+        }
+        size_t i = b;
+        for (; i + 2 <= e; i += 2) {
+            __m128d vx = _mm_loadu_pd(x + i), vy = _mm_loadu_pd(y + i), vz = _mm_loadu_pd(z + i), vw = _mm_loadu_pd(w + i);
+            for (size_t r = 0; r < 4; ++r) {
+                __m128d o = _mm_add_pd(
+                    _mm_add_pd(_mm_mul_pd(c[r * 4], vx), _mm_mul_pd(c[r * 4 + 1], vy)),
+                    _mm_add_pd(_mm_mul_pd(c[r * 4 + 2], vz), _mm_mul_pd(c[r * 4 + 3], vw))
+                );
+                _mm_storeu_pd((r == 0? x : r == 1? y : r == 2? z : w) + i, o);
+            }
+        }
+        _transformSoA<double>(m, x, y, z, w, i, e);
+    }
+
+    #endif
+
+    /**
+
+    @brief Transforms vertices [ @param begin, @param end ) of @param buffer by @param m, in place.
+    Disjoint ranges of the same buffer may be transformed concurrently.
+
+    */
+
+    template <typename T, typename U, typename L>
+    inline void transform(const Matrix<U, 4, 4, L> &m, VertexBuffer<T> &buffer, size_t begin, size_t end) {
+        T c[16];
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                c[i * 4 + j] = static_cast<T>(m.get(i, j));
+            }
+        }
+        _transformSoA(c, buffer.x(), buffer.y(), buffer.z(), buffer.w(), begin, end);
+    }
+
+    ///@brief Transforms every vertex of @param buffer by @param m, in place.
+    template <typename T, typename U, typename L>
+    inline void transform(const Matrix<U, 4, 4, L> &m, VertexBuffer<T> &buffer) {
+        transform(m, buffer, 0, buffer.size());
+    }
+
+    #ifdef JML_THREADS
+
+    ///@brief Transforms every vertex of @param buffer by @param m, in place, splitting the buffer evenly across @param threads threads.
+    template <typename T, typename U, typename L>
+    inline void transform(const Matrix<U, 4, 4, L> &m, VertexBuffer<T> &buffer, unsigned threads) {
+        size_t n = buffer.size();
+        if (threads <= 1 || n < threads) {
+            transform(m, buffer, 0, n);
+            return;
+        }
+        size_t chunk = (n + threads - 1) / threads;
+        std::thread *workers = new std::thread[threads - 1];
+        for (unsigned t = 1; t < threads; ++t) {
+            size_t b = t * chunk, e = (b + chunk < n? b + chunk : n);
+            if (b < e) {
+                workers[t - 1] = std::thread([&m, &buffer, b, e]() {
+                    transform(m, buffer, b, e);
+                });
+            }
+        }
+        transform(m, buffer, 0, chunk);
+        for (unsigned t = 0; t < threads - 1; ++t) {
+            if (workers[t].joinable()) {
+                workers[t].join();
+            }
+        }
+        delete[] workers;
+    }
+
+    #endif
+}
+
+#endif // JML_VERTEX_BUFFER_H
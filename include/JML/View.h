@@ -0,0 +1,237 @@
+#ifndef JML_VIEW_H
+#define JML_VIEW_H
+
+/**
+
+@file       View.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements non-owning views which index directly into a vector's or matrix's storage.
+
+@warning A view only refers to the storage it was created from, and must not outlive it.
+
+*/
+
+#include <JML/Expression.h>
+
+namespace jml {
+
+    template <typename T>
+    struct _Unqualified {
+        typedef T Type;
+    };
+
+    template <typename T>
+    struct _Unqualified<const T> {
+        typedef T Type;
+    };
+
+    /**
+
+    @brief Iterator which steps through memory by a fixed number of elements.
+
+    */
+
+    template <typename T>
+    class StridedIterator {
+    public:
+        StridedIterator(T *p, size_t s) : ptr(p), stride(s) {}
+
+        T &operator*() const {return *ptr;}
+        StridedIterator &operator++() {
+            ptr += stride;
+            return *this;
+        }
+        bool operator==(const StridedIterator &o) const {return ptr == o.ptr;}
+        bool operator!=(const StridedIterator &o) const {return ptr != o.ptr;}
+
+    private:
+        T *ptr;
+        size_t stride;
+    };
+
+    /**
+
+    @brief Non-owning view of @param length elements, spaced @param stride elements apart.
+    @param T: Element type. Const-qualify it to make a read-only view.
+
+    */
+
+    template <typename T, size_t length>
+    class VectorView : public VectorExpression<VectorView<T, length> > {
+    public:
+
+        static constexpr size_t nLength = length;
+
+        typedef typename _Unqualified<T>::Type type;
+        typedef StridedIterator<T> Iterator;
+
+        VectorView(T *p, size_t s) : ptr(p), stride(s) {}
+
+        type get(size_t i) const {
+            return ptr[i * stride];
+        }
+
+        T &operator[](size_t i) const {
+            return ptr[i * stride];
+        }
+
+        constexpr size_t getLength() const {
+            return length;
+        }
+
+        Iterator begin() const {
+            return Iterator(ptr, stride);
+        }
+
+        Iterator end() const {
+            return Iterator(ptr + length * stride, stride);
+        }
+
+        /**
+
+        @brief Writes the elements of @param v through the view.
+
+        */
+
+        template <typename E>
+        const VectorView &operator=(const VectorExpression<E> &v) const {
+            static_assert(E::nLength == length, "Assigning expression of mismatched length to vector view.");
+            const E &e = v.self();
+            for (size_t i = 0; i < length; ++i) {
+                ptr[i * stride] = static_cast<type>(e.get(i));
+            }
+            return *this;
+        }
+
+        const VectorView &operator=(const VectorView &v) const {
+            return operator=(static_cast<const VectorExpression<VectorView>&>(v));
+        }
+
+    private:
+        T *ptr;
+        size_t stride;
+    };
+
+    /**
+
+    @brief Iterator over the rows of a strided matrix, producing a VectorView per row.
+
+    */
+
+    template <typename T, size_t cols>
+    class RowIterator {
+    public:
+        RowIterator(T *p, size_t rs, size_t cs) : ptr(p), rowStride(rs), colStride(cs) {}
+
+        VectorView<T, cols> operator*() const {return VectorView<T, cols>(ptr, colStride);}
+        RowIterator &operator++() {
+            ptr += rowStride;
+            return *this;
+        }
+        bool operator==(const RowIterator &o) const {return ptr == o.ptr;}
+        bool operator!=(const RowIterator &o) const {return ptr != o.ptr;}
+
+    private:
+        T *ptr;
+        size_t rowStride, colStride;
+    };
+
+    /**
+
+    @brief Non-owning view of a @param rows by @param cols block of a matrix's storage.
+
+    */
+
+    template <typename T, size_t rows, size_t cols>
+    class MatrixView : public MatrixExpression<MatrixView<T, rows, cols> > {
+    public:
+
+        typedef typename _Unqualified<T>::Type ValueType;
+
+        static constexpr size_t nRows = rows;
+        static constexpr size_t nCols = cols;
+
+        MatrixView(T *p, size_t rs, size_t cs) : ptr(p), rowStride(rs), colStride(cs) {}
+
+        ValueType get(size_t x, size_t y) const {
+            return ptr[x * rowStride + y * colStride];
+        }
+
+        VectorView<T, cols> operator[](size_t i) const {
+            return getRow(i);
+        }
+
+        VectorView<T, cols> getRow(size_t i) const {
+            return VectorView<T, cols>(ptr + i * rowStride, colStride);
+        }
+
+        VectorView<T, rows> getCol(size_t i) const {
+            return VectorView<T, rows>(ptr + i * colStride, rowStride);
+        }
+
+        constexpr size_t numRows() const {
+            return rows;
+        }
+
+        constexpr size_t numCols() const {
+            return cols;
+        }
+
+        RowIterator<T, cols> begin() const {
+            return RowIterator<T, cols>(ptr, rowStride, colStride);
+        }
+
+        RowIterator<T, cols> end() const {
+            return RowIterator<T, cols>(ptr + rows * rowStride, rowStride, colStride);
+        }
+
+        ///@return The same storage with rows and columns exchanged.
+        MatrixView<T, cols, rows> transpose() const {
+            return MatrixView<T, cols, rows>(ptr, colStride, rowStride);
+        }
+
+    private:
+        T *ptr;
+        size_t rowStride, colStride;
+    };
+
+    /**
+
+    @brief Non-owning view of a matrix with one row and one column excluded.
+
+    */
+
+    template <typename T, size_t rows, size_t cols>
+    class SubMatrixView : public MatrixExpression<SubMatrixView<T, rows, cols> > {
+    public:
+
+        typedef typename _Unqualified<T>::Type ValueType;
+
+        static constexpr size_t nRows = rows;
+        static constexpr size_t nCols = cols;
+
+        SubMatrixView(T *p, size_t rs, size_t cs, size_t er, size_t ec) : ptr(p), rowStride(rs), colStride(cs), exRow(er), exCol(ec) {}
+
+        ValueType get(size_t x, size_t y) const {
+            return ptr[(x + (x >= exRow)) * rowStride + (y + (y >= exCol)) * colStride];
+        }
+
+        constexpr size_t numRows() const {
+            return rows;
+        }
+
+        constexpr size_t numCols() const {
+            return cols;
+        }
+
+    private:
+        T *ptr;
+        size_t rowStride, colStride, exRow, exCol;
+    };
+}
+
+#endif // JML_VIEW_H
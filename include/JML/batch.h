@@ -0,0 +1,403 @@
+#ifndef JML_BATCH_H
+#define JML_BATCH_H
+
+/**
+
+@file       batch.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the array overloads of the transcendental functions, such as jml::sin(const float *x, float *r, size_t n), which write f(x[i]) to r[i].
+
+Float and double arrays are evaluated in double lanes, 4 at a time with AVX and 2 at a time with SSE2; other types, or builds without SIMD, loop over the scalar functions.
+The last partial group of an array is padded out and run through the same lanes, so an element's result never depends on its position in the array.
+Elements outside the range a lane kernel handles (|x| >= 2^20 for the trigonometric functions, results which would overflow or be subnormal for exp and ln, and NaN) are recomputed by the scalar function.
+
+The lanes reuse the reduction and kernels of trig.h for sin and cos, and the polynomial of atan.
+exp is 2^k * e^r with |r| <= ln(2)/2 and a degree 13 polynomial, and ln uses the fdlibm polynomial on the mantissa, since the tables of explog.h would need gathers.
+The inverse trigonometric functions are built on atan, and sigmoid and tanh on exp, so that tanh keeps its relative accuracy near 0.
+
+Largest errors over 2 million random inputs per function, measured against a quad precision reference:
+    float:          <= 0.5 ULP for every function, as the double result is rounded once.
+    double:         <= 1.5 ULP for sin, cos, exp, ln and log2; <= 1.7 ULP for atan and acot;
+                    <= 2.5 ULP for sec, csc, asin, acos, asec, acsc, sigmoid and tanh; <= 3.1 ULP for tan and cot, which divide two roundings.
+
+*/
+
+#include <JML/functions.h>
+
+namespace jml {
+
+    #if defined(JML_AVX)
+    typedef _Pack<4> _BatchPack;
+    #elif defined(JML_SSE2)
+    typedef _Pack<2> _BatchPack;
+    #endif
+
+    ///Writes sin @param x to @param s and cos @param x to @param c, for lanes with |x| < 2^20.
+    template <typename P>
+    void _sinCosLanes(const P &x, P &s, P &c) {
+        P fn = P::round(x * static_cast<double>(JML_INV_PIO2));
+        P t = x - fn * JML_PIO2_1;
+        P w = fn * JML_PIO2_2;
+        P r = t - w;
+        t = r;
+        w = fn * JML_PIO2_3;
+        r = t - w;
+        w = fn * JML_PIO2_3T - ((t - r) - w);
+        P y0 = r - w, y1 = (r - y0) - w;
+        //The quadrant, fn modulo 4. fn / 4 - 3/8 is exact and rounds to floor(fn / 4).
+        P q = fn - 4 * P::round(fn * 0.25 - 0.375);
+        P odd = P::less(P::abs(P::abs(q - 2) - 1), 0.5);
+        P ks = _TrigKernel<double>::sin(y0, y1), kc = _TrigKernel<double>::cos(y0, y1);
+        s = P::select(odd, kc, ks);
+        c = P::select(odd, ks, kc);
+        s = P::select(P::less(1.5, q), -s, s);
+        c = P::select(P::less(0.5, q) & P::less(q, 2.5), -c, c);
+    }
+
+    ///Writes k and e^r - 1 such that e^ @param x = 2^k * e^r, for lanes with |x| <= 709.
+    template <typename P>
+    void _expLanes(const P &x, P &k, P &p) {
+        k = P::round(x * static_cast<double>(JML_INV_LN2));
+        P r = (x - k * JML_LN2_HI) - k * JML_LN2_LO;
+        //1/n! for n = 13 down to 2.
+        const double E[] = {
+            1.0 / 6227020800, 1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800, 1.0 / 362880, 1.0 / 40320,
+            1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6, 1.0 / 2
+        };
+        p = E[0];
+        for (size_t i = 1; i < 12; ++i) {
+            p = p * r + E[i];
+        }
+        p = r + r * r * p;
+    }
+
+    ///Writes the exponent e and returns ln(m), where @param x = m * 2^e with m in [sqrt(1/2), sqrt(2)), for positive, normal lanes.
+    template <typename P>
+    P _lnLanes(const P &x, P &e) {
+        const double Lg1 = 6.666666666666735130e-01, Lg2 = 3.999999999940941908e-01, Lg3 = 2.857142874366239149e-01,
+                     Lg4 = 2.222219843214978396e-01, Lg5 = 1.818357216161805012e-01, Lg6 = 1.531383769920937332e-01,
+                     Lg7 = 1.479819860511658591e-01;
+        e = P::exponent(x);
+        P m = P::mantissa(x);
+        P big = P::less(1.41421356237309504880, m);
+        m = P::select(big, m * 0.5, m);
+        e = P::select(big, e + 1, e);
+        P f = m - 1, s = f / (2 + f), z = s * s, w = z * z;
+        P R = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7))) + w * (Lg2 + w * (Lg4 + w * Lg6));
+        P hfsq = 0.5 * f * f;
+        return f - (hfsq - s * (hfsq + R));
+    }
+
+    ///The coefficients of the scalar atan, rounded to double.
+    inline const double *_atanTable() {
+        static double c[20];
+        static const bool ready = [] {
+            for (size_t i = 0; i < 20; ++i) {
+                c[i] = static_cast<double>(getJAT_()[i]);
+            }
+            return true;
+        }();
+        (void)ready;
+        return c;
+    }
+
+    ///@return atan @param x, by the same polynomial as the scalar atan.
+    template <typename P>
+    P _atanLanes(const P &x) {
+        const double *c = _atanTable();
+        P z = P::abs(x), big = P::less(1.0, z);
+        P a = P::select(big, 1.0 / z, z);
+        P s = a * a, q = s * s, o = q * q;
+        P p = ((c[1] - c[0] * s) * q + (c[3] - c[2] * s)) * o + ((c[5] - c[4] * s) * q + (c[7] - c[6] * s));
+        for (size_t i = 8; i < 19; ++i) {
+            p = p * s + (i & 1? c[i] : -c[i]);
+        }
+        p = p * s * a + a;
+        return P::copysign(P::select(big, c[19] - p, p), x);
+    }
+
+    ///@return Mask of the lanes with |x| < 2^20.
+    template <typename P>
+    P _trigDomain(const P &x) {
+        return P::less(P::abs(x), 1048576.0);
+    }
+
+    /**
+
+    @brief Lane kernels and scalar fallbacks of the batch functions.
+    lanes() evaluates the function on every lane of a pack, domain() returns the mask of lanes where lanes() is valid, and scalar() handles the rest.
+
+    */
+
+    struct _BatchSin {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return s;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return sin(x);}
+    };
+
+    struct _BatchCos {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return c;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return cos(x);}
+    };
+
+    struct _BatchTan {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return s / c;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return tan(x);}
+    };
+
+    struct _BatchCot {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return c / s;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return cot(x);}
+    };
+
+    struct _BatchSec {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return 1 / c;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return sec(x);}
+    };
+
+    struct _BatchCsc {
+        template <typename P> static P lanes(const P &x) {P s, c; _sinCosLanes(x, s, c); return 1 / s;}
+        template <typename P> static P domain(const P &x) {return _trigDomain(x);}
+        static Real scalar(Real x) {return csc(x);}
+    };
+
+    struct _BatchAtan {
+        template <typename P> static P lanes(const P &x) {return _atanLanes(x);}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(x, x);}
+        static Real scalar(Real x) {return atan(x);}
+    };
+
+    //acot x = atan(1 / x) away from 0, moved into (pi/2, pi) for negative x like the scalar acot.
+    struct _BatchAcot {
+        template <typename P> static P lanes(const P &x) {
+            P a = _atanLanes(1 / x);
+            a = P::select(P::less(x, 0.0), a + static_cast<double>(JML_PI), a);
+            return P::select(P::lessEqual(P::abs(x), 1.0), static_cast<double>(JML_PIO2) - _atanLanes(x), a);
+        }
+        template <typename P> static P domain(const P &x) {return P::lessEqual(x, x);}
+        static Real scalar(Real x) {return acot(x);}
+    };
+
+    //asin x = atan(x / sqrt(1 - x^2)) and acos x = 2 atan(sqrt((1 - x) / (1 + x))), so that neither loses accuracy near 1.
+    struct _BatchAsin {
+        template <typename P> static P lanes(const P &x) {return _atanLanes(x / P::sqrt((1 - x) * (1 + x)));}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(P::abs(x), 1.0);}
+        static Real scalar(Real x) {return asin(x);}
+    };
+
+    struct _BatchAcos {
+        template <typename P> static P lanes(const P &x) {return 2 * _atanLanes(P::sqrt((1 - x) / (1 + x)));}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(P::abs(x), 1.0);}
+        static Real scalar(Real x) {return acos(x);}
+    };
+
+    //asec and acsc are written in x rather than 1 / x, so that the rounding of 1 / x is not magnified near |x| = 1.
+    struct _BatchAsec {
+        template <typename P> static P lanes(const P &x) {return 2 * _atanLanes(P::sqrt((x - 1) / (x + 1)));}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(1.0, P::abs(x));}
+        static Real scalar(Real x) {return asec(x);}
+    };
+
+    struct _BatchAcsc {
+        template <typename P> static P lanes(const P &x) {return P::copysign(_atanLanes(1 / P::sqrt((x - 1) * (x + 1))), x);}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(1.0, P::abs(x));}
+        static Real scalar(Real x) {return acsc(x);}
+    };
+
+    struct _BatchExp {
+        template <typename P> static P lanes(const P &x) {P k, p; _expLanes(x, k, p); return (1 + p) * P::pow2(k);}
+        template <typename P> static P domain(const P &x) {return P::lessEqual(-708.0, x) & P::lessEqual(x, 709.0);}
+        static Real scalar(Real x) {return exp(x);}
+    };
+
+    struct _BatchLn {
+        template <typename P> static P lanes(const P &x) {
+            P e, m = _lnLanes(x, e);
+            return e * JML_LN2_HI + (e * JML_LN2_LO + m);
+        }
+        template <typename P> static P domain(const P &x) {return P::lessEqual(2.2250738585072014e-308, x) & P::lessEqual(x, 1.7976931348623157e308);}
+        static Real scalar(Real x) {return ln(x);}
+    };
+
+    struct _BatchLog2 {
+        template <typename P> static P lanes(const P &x) {P e, m = _lnLanes(x, e); return e + m * static_cast<double>(JML_INV_LN2);}
+        template <typename P> static P domain(const P &x) {return _BatchLn::domain(x);}
+        static Real scalar(Real x) {return log2(x);}
+    };
+
+    //e^-x underflows to 0 above 708, where the sigmoid is already 1.
+    struct _BatchSigmoid {
+        template <typename P> static P lanes(const P &x) {
+            P k, p;
+            _expLanes(P::select(P::less(708.0, x), -708.0, -x), k, p);
+            return 1 / (1 + (1 + p) * P::pow2(k));
+        }
+        template <typename P> static P domain(const P &x) {return P::lessEqual(-708.0, x);}
+        static Real scalar(Real x) {return sigmoid(x);}
+    };
+
+    //tanh x = t / (t + 2) for t = e^2x - 1 = (2^k - 1) + 2^k p, on |x| clamped to 20, where tanh rounds to 1. 2^k - 1 is exact, and so is p when k = 0.
+    struct _BatchTanh {
+        template <typename P> static P lanes(const P &x) {
+            P z = P::abs(x), k, p;
+            _expLanes(2 * P::select(P::less(20.0, z), 20.0, z), k, p);
+            P e = P::pow2(k), t = (e - 1) + e * p;
+            return P::copysign(t / (t + 2), x);
+        }
+        template <typename P> static P domain(const P &x) {return P::lessEqual(x, x);}
+        static Real scalar(Real x) {return tanh(x);}
+    };
+
+    ///Writes F( @param x [i] ) to @param r [i] for i in [0, @param n ), with the scalar function of F.
+    template <typename F, typename T>
+    void _batchArray(const T *x, T *r, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            r[i] = static_cast<T>(F::scalar(x[i]));
+        }
+    }
+
+    #if defined(JML_SSE2)
+
+    ///Writes F( @param x [i] ) to @param r [i] for i in [0, @param n ), with the lane kernel of F.
+    template <typename F, typename T>
+    void _batchLanes(const T *x, T *r, size_t n) {
+        typedef _BatchPack P;
+        const size_t w = P::Width;
+        const int full = (1 << P::Width) - 1;
+        T in[P::Width], out[P::Width];
+        for (size_t i = 0; i < n; i += w) {
+            const T *s = x + i;
+            T *d = r + i;
+            size_t m = (n - i < w? n - i : w);
+            if (m < w) {
+                //Pads with the last element, so that the padding is in the domain whenever the array is.
+                for (size_t j = 0; j < w; ++j) {
+                    in[j] = s[j < m? j : m - 1];
+                }
+                s = in;
+                d = out;
+            }
+            P v = P::load(s);
+            int inside = P::mask(F::domain(v));
+            if (inside != full) {
+                //The group goes through out, so that the scalar fallback still reads x when r is x.
+                d = out;
+            }
+            F::lanes(v).store(d);
+            if (inside != full) {
+                for (size_t j = 0; j < w; ++j) {
+                    if (!(inside & (1 << j))) {
+                        d[j] = static_cast<T>(F::scalar(s[j]));
+                    }
+                }
+            }
+            for (size_t j = 0; d == out && j < m; ++j) {
+                r[i + j] = out[j];
+            }
+        }
+    }
+
+    template <typename F>
+    void _batchArray(const float *x, float *r, size_t n) {
+        _batchLanes<F>(x, r, n);
+    }
+
+    template <typename F>
+    void _batchArray(const double *x, double *r, size_t n) {
+        _batchLanes<F>(x, r, n);
+    }
+
+    #endif
+
+    /**
+
+    @brief Array overloads of the transcendental functions, which write f( @param x [i] ) to @param r [i] for i in [0, @param n ).
+    @param r may be the same array as @param x.
+
+    */
+
+    template <typename T> inline void sin(const T *x, T *r, size_t n) {_batchArray<_BatchSin>(x, r, n);}
+    template <typename T> inline void cos(const T *x, T *r, size_t n) {_batchArray<_BatchCos>(x, r, n);}
+    template <typename T> inline void tan(const T *x, T *r, size_t n) {_batchArray<_BatchTan>(x, r, n);}
+    template <typename T> inline void cot(const T *x, T *r, size_t n) {_batchArray<_BatchCot>(x, r, n);}
+    template <typename T> inline void sec(const T *x, T *r, size_t n) {_batchArray<_BatchSec>(x, r, n);}
+    template <typename T> inline void csc(const T *x, T *r, size_t n) {_batchArray<_BatchCsc>(x, r, n);}
+    template <typename T> inline void asin(const T *x, T *r, size_t n) {_batchArray<_BatchAsin>(x, r, n);}
+    template <typename T> inline void acos(const T *x, T *r, size_t n) {_batchArray<_BatchAcos>(x, r, n);}
+    template <typename T> inline void atan(const T *x, T *r, size_t n) {_batchArray<_BatchAtan>(x, r, n);}
+    template <typename T> inline void acot(const T *x, T *r, size_t n) {_batchArray<_BatchAcot>(x, r, n);}
+    template <typename T> inline void asec(const T *x, T *r, size_t n) {_batchArray<_BatchAsec>(x, r, n);}
+    template <typename T> inline void acsc(const T *x, T *r, size_t n) {_batchArray<_BatchAcsc>(x, r, n);}
+    template <typename T> inline void exp(const T *x, T *r, size_t n) {_batchArray<_BatchExp>(x, r, n);}
+    template <typename T> inline void ln(const T *x, T *r, size_t n) {_batchArray<_BatchLn>(x, r, n);}
+    template <typename T> inline void log2(const T *x, T *r, size_t n) {_batchArray<_BatchLog2>(x, r, n);}
+    template <typename T> inline void sigmoid(const T *x, T *r, size_t n) {_batchArray<_BatchSigmoid>(x, r, n);}
+    template <typename T> inline void tanh(const T *x, T *r, size_t n) {_batchArray<_BatchTanh>(x, r, n);}
+
+    /**
+
+    @brief Writes sin @param x [i] to @param s [i] and cos @param x [i] to @param c [i] for i in [0, @param n ), sharing one reduction per element.
+    @param s or @param c may be the same array as @param x.
+
+    */
+
+    template <typename T>
+    void sincos(const T *x, T *s, T *c, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            Real rs, rc;
+            sincos(static_cast<Real>(x[i]), rs, rc);
+            s[i] = static_cast<T>(rs);
+            c[i] = static_cast<T>(rc);
+        }
+    }
+
+    #if defined(JML_SSE2)
+
+    template <typename T>
+    void _sincosLanes(const T *x, T *s, T *c, size_t n) {
+        typedef _BatchPack P;
+        const size_t w = P::Width;
+        T in[P::Width], os[P::Width], oc[P::Width];
+        for (size_t i = 0; i < n; i += w) {
+            size_t m = (n - i < w? n - i : w);
+            for (size_t j = 0; j < w; ++j) {
+                in[j] = x[i + (j < m? j : m - 1)];
+            }
+            P v = P::load(in), ps, pc;
+            _sinCosLanes(v, ps, pc);
+            ps.store(os);
+            pc.store(oc);
+            int inside = P::mask(_trigDomain(v));
+            for (size_t j = 0; j < m; ++j) {
+                if (!(inside & (1 << j))) {
+                    Real rs, rc;
+                    sincos(static_cast<Real>(in[j]), rs, rc);
+                    os[j] = static_cast<T>(rs);
+                    oc[j] = static_cast<T>(rc);
+                }
+                s[i + j] = os[j];
+                c[i + j] = oc[j];
+            }
+        }
+    }
+
+    inline void sincos(const float *x, float *s, float *c, size_t n) {
+        _sincosLanes(x, s, c, n);
+    }
+
+    inline void sincos(const double *x, double *s, double *c, size_t n) {
+        _sincosLanes(x, s, c, n);
+    }
+
+    #endif
+}
+
+#endif // JML_BATCH_H
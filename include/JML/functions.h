@@ -1,11 +1,13 @@
 #ifndef JML_FUNCTIONS_H
 #define JML_FUNCTIONS_H
 
-#include <JML/constants.h>
+#include <JML/trig.h>
+#include <JML/explog.h>
+#include <JML/sqrt.h>
 
 namespace jml {
-    inline const long double *getJAT_() {
-        static const long double JAT_[] = {
+    inline const Real *getJAT_() {
+        static const Real JAT_[] = {
             0x1.53e1d2a25ff34p-16L,
             0x1.d3b63dbb65af4p-13L,
             0x1.312788dde0801p-10L,
@@ -31,7 +33,11 @@ namespace jml {
         return JAT_;
     }
 
-    inline long double abs(long double z) {
+    template <
+        typename T,
+        typename = typename jutil::Enable<jutil::IsArithmatic<T>::Value>::Type
+    >
+    inline constexpr T abs(const T &z) {
         return (z < 0? z * -1 : z);
     }
 
@@ -42,12 +48,12 @@ namespace jml {
         typename = typename jutil::Enable<jutil::IsArithmatic<U>::Value>::Type
     >
     int8_t compare(const T &a, const U &b) {
-        double d = abs(static_cast<long double>(a) - static_cast<long double>(b));
-        if (d < JML_EPSILON) {
+        Real d = abs(static_cast<Real>(a) - static_cast<Real>(b));
+        if (d < Real(JML_EPSILON)) {
             return JML_EQUAL;
-        } else if (d > JML_EPSILON && a < b) {
+        } else if (d > Real(JML_EPSILON) && a < b) {
             return JML_LESS;
-        } else if (d > JML_EPSILON && a > b) {
+        } else if (d > Real(JML_EPSILON) && a > b) {
             return JML_GREATER;
         } else {
             return -0x80;
@@ -70,218 +76,191 @@ namespace jml {
         return (compare(a, b) == JML_GREATER? b : a);
     }
 
-    inline int16_t sign(long double z) {
+    inline int16_t sign(Real z) {
         return (z < 0? -1 : 1);
     }
 
-    inline long double fma(long double x, long double y, long double z) {
+    inline Real fma(Real x, Real y, Real z) {
         return (x * y) + z;
     }
 
-    inline long double copysign(long double x, long double y) {
-        long double r = abs(x);
+    inline Real copysign(Real x, Real y) {
+        Real r = abs(x);
         r *= sign(y);
         return r;
     }
 
-    inline long double factorial(long unsigned n) {
-        long double r = 1;
+    inline Real factorial(long unsigned n) {
+        Real r = 1;
         for (long unsigned i = n; i >= 1; --i) {
             r *= i;
         }
         return r;
     }
-    inline constexpr long double e() {
-        return JML_E;
+    inline constexpr Real e() {
+        return Real(JML_E);
     }
 
-    inline long double _preptrig(long double a) {
-        while (a > (2 * JML_PI)) {
-            a -= 2 * JML_PI;
-        }
-        while (a < -(2 * JML_PI)) {
-            a += 2 * JML_PI;
-        }
-        return a;
+    inline float sqrtf(float x) {
+        return _sqrt(x);
     }
 
-    inline float sqrtf(float x) {
-        const long double xhalf = 0.5f*x;
-
-        union // get bits for floating value
-        {
-            float x;
-            int i;
-        } u;
-        u.x = x;
-        u.i = 0x5f300000 - (u.i >> 1);
-        return x*u.x*(1.5f - xhalf*u.x*u.x);
-    }
-
-    inline long double derivitive(long double(*f)(long double), long double a) {
-        double a1 = a - JML_EPSILON;
-        double a2 = a +  JML_EPSILON;
-        double f1 = f(a1);
-        double f2 = f(a2);
+    inline Real derivitive(Real(*f)(Real), Real a) {
+        Real a1 = a - Real(JML_EPSILON);
+        Real a2 = a +  Real(JML_EPSILON);
+        Real f1 = f(a1);
+        Real f2 = f(a2);
         return (f2 - f1) / (a2 - a1);
     }
 
-    inline long double round(long double z, uint8_t m) {
-        return static_cast<long double>(static_cast<int64_t>(m == JML_ROUND_UP? z + 1 : z));
+    inline Real round(Real z, uint8_t m) {
+        return static_cast<Real>(static_cast<int64_t>(m == JML_ROUND_UP? z + 1 : z));
     }
 
-     inline jutil::Tuple<int64_t, long double> modf(long double z) {
+     inline jutil::Tuple<int64_t, Real> modf(Real z) {
         int64_t i = z;
-        long double d = abs(z - i);
-        return jutil::Tuple<int64_t, long double>(i, d);
+        Real d = abs(z - i);
+        return jutil::Tuple<int64_t, Real>(i, d);
     }
 
-    inline long double round(long double z) {
-        long double d = jutil::get<1>(modf(z));
-        return round(z, (d < 0.5L? JML_ROUND_DOWN : JML_ROUND_UP));
+    inline Real round(Real z) {
+        Real d = jutil::get<1>(modf(z));
+        return round(z, (d < Real(0.5)? JML_ROUND_DOWN : JML_ROUND_UP));
     }
 
     
 
-    inline long double _ipow(long double n, long double nn, long e, long c) {
-        if (e > 0) {
-                while (c < e) {
-                    nn *= n;
-                    ++c;
-                }
-                return nn;
-        } else if (e == 0) {
-            return 1.0L;
-        } else {
-            return 1.0L / _ipow(n, nn, -e, c);
+    inline Real _ipow(Real n, long e) {
+        Real r = 1;
+        unsigned long k = (e < 0? 0UL - static_cast<unsigned long>(e) : static_cast<unsigned long>(e));
+        while (k) {
+            if (k & 1) {
+                r *= n;
+            }
+            n *= n;
+            k >>= 1;
         }
+        return (e < 0? Real(1.0) / r : r);
     }
 
-    long double root(long double, long double);
+    /**
+
+    @return Square root of @param n.
+    @param m: JML_SQRT_EXACT for the correctly rounded root, or JML_SQRT_FAST for a refined reciprocal estimate.
+
+    */
 
-    inline long double sqrt(long double n) {
-        return root(n, 2);
+    inline Real sqrt(Real n, uint8_t m = JML_SQRT_EXACT) {
+        return _sqrtMode(n, m);
     }
 
-    long double _ln(long double, long double, size_t);
+    ///@return 1 / sqrt @param n, computed in the mode @param m.
+    inline Real rsqrt(Real n, uint8_t m = JML_SQRT_EXACT) {
+        return _rsqrtMode(n, m);
+    }
 
-    inline long double ln(long double z) {
-        return _ln(z, 0, 0);
+    ///@brief Writes the square roots of the @param n values at @param x to @param r, which may be @param x, in the mode @param m.
+    template <typename T>
+    inline void sqrt(const T *x, T *r, size_t n, uint8_t m = JML_SQRT_EXACT) {
+        _sqrtArray(x, r, n, m, false);
     }
 
-    inline long double log(long double b, long double z) {
-        return (ln(z) / ln(b));
+    ///@brief Writes the reciprocal square roots of the @param n values at @param x to @param r, which may be @param x, in the mode @param m.
+    template <typename T>
+    inline void rsqrt(const T *x, T *r, size_t n, uint8_t m = JML_SQRT_EXACT) {
+        _sqrtArray(x, r, n, m, true);
     }
 
-    inline long double log(long double z) {
-        return log(JML_E, z);
+    inline Real ln(Real z) {
+        return _ln(z);
     }
 
-    long double exp(long double);
+    inline Real log2(Real z) {
+        return _log2(z);
+    }
 
-    inline long double _pow(long double a, long double b) {
-        if (b < 0) {
-            return 1.0L / _pow(a, -b);
-        } else if (b == 0) {
-            return 1.0L;
-        } else {
-            return exp(b * log(a));
-        }
+    inline Real log(Real b, Real z) {
+        return (ln(z) / ln(b));
     }
 
-    template <typename T>
-    inline long double pow(long double n, T z) {
-        return _ipow(n, n, static_cast<long>(z), 1);
+    inline Real log(Real z) {
+        return ln(z);
     }
 
-    template <>
-    inline long double pow<long double>(long double a, long double b) {
-        return _pow(a, b);
+    inline Real exp(Real z) {
+        return _exp(z);
     }
 
-    template <>
-    inline long double pow<double>(long double a, double b) {
-        return _pow(a, b);
+    ///@return e^ @param z - 1, accurate for z near 0.
+    inline Real expm1(Real z) {
+        return _expm1(z);
     }
 
-    template <>
-    inline long double pow<float>(long double a, float b) {
-        return _pow(a, b);
+    template <typename T>
+    inline Real pow(Real n, T z) {
+        return _ipow(n, static_cast<long>(z));
     }
 
-    inline long double root(long double n, long double r) {
-        return pow(n, 1.0L / r);
+    template <>
+    inline Real pow<long double>(Real a, long double b) {
+        return _pow<Real>(a, b);
     }
 
-    inline long double _ln(long double z, long double nz, size_t e) {
-        long double t;
-        uint64_t c;
-        do {
-            c = 2 * e + 1;
-            t = 2.0L * ((1.0L / c) * pow((z - 1.0L) / (z + 1.0L), c));
-            nz += t;
-            ++e;
-        } while (jml::abs(t) >= JML_EPSILON);
-        return nz;
+    template <>
+    inline Real pow<double>(Real a, double b) {
+        return _pow<Real>(a, b);
     }
 
-    inline long double exp(long double z) {
-        long double sum = 1 + z;
-        long double n = 0;
-        for (size_t i = 2; (n = pow(z, i) / factorial(i)) > JML_CUT; ++i) {
-            sum += n;
-        }
-        return sum;
+    template <>
+    inline Real pow<float>(Real a, float b) {
+        return _pow<Real>(a, b);
     }
 
-    inline long double _trig(long double x, long double nx, size_t c, int16_t m) {
-        size_t r = c * 2 - (m == JML_TRIG_EVEN? 0 : 1);
-        long double d = (pow(x, r) / factorial(r)) * (c % 2 == 0? sign(m) : -1 * sign(m));
-        if (abs(d) > JML_CUT) {
-            return _trig(x, nx + d, c + 1, m);
-        } else {
-            return nx;
-        }
+    inline Real root(Real n, Real r) {
+        return pow(n, Real(1.0) / r);
     }
 
-    inline long double _atrig(long double x, long double nx, size_t c) {
+    inline Real _atrig(Real x, Real nx, size_t c) {
         long _2n = 2 * c;
         long _2np1 = _2n + 1;
-        long double d = (factorial(_2n) / (pow(2, _2n) * pow(factorial(c), 2))) * (pow(x, _2np1) / _2np1);
-        if (abs(d) > JML_CUT) {
+        Real d = (factorial(_2n) / (pow(2, _2n) * pow(factorial(c), 2))) * (pow(x, _2np1) / _2np1);
+        if (abs(d) > Real(JML_CUT)) {
             return _atrig(x, nx + d, c + 1);
         } else {
             return nx;
         }
     }
 
-    inline long double cos(long double a) {
-        a = _preptrig(a);
-        return _trig(a, 1, 1, JML_TRIG_EVEN);
+    inline Real cos(Real a) {
+        return _cos(a);
     }
 
-    inline long double sin(long double a) {
-        a = _preptrig(a);
-        return _trig(a, a, 2, JML_TRIG_ODD);
+    inline Real sin(Real a) {
+        return _sin(a);
     }
 
-    inline long double asin(long double a) {
+    ///@brief Writes sin @param a to @param s and cos @param a to @param c, for about the cost of one of them.
+    inline void sincos(Real a, Real &s, Real &c) {
+        _sincos(a, s, c);
+    }
+
+    inline Real asin(Real a) {
         return _atrig(a, 0, 0);
     }
 
-    inline long double acos(long double a) {
-        return JML_PIO2 - asin(a);
+    inline Real acos(Real a) {
+        return Real(JML_PIO2) - asin(a);
     }
 
-    inline long double atan(long double x) {
+    inline Real atan(Real x) {
 
         if (x < 0) {
             return -atan(abs(x));
         }
 
-        long double a, z, p, r, s, q, o;
+        Real a, z, p, r, s, q, o;
         z = abs(x);
-        a = (z > 1.0L? 1.0L / z : z);
+        a = (z > Real(1.0)? Real(1.0) / z : z);
         s = a * a;
         q = s * s;
         o = q * q;
@@ -316,73 +295,135 @@ namespace jml {
         return copysign(r, x);
     }
 
-    inline long double atan2(long double y, long double x) {
-        if (x > 0) {
+    /**
+
+    @brief Polynomial of Abramowitz and Stegun 4.4.49, the tier of atan2 behind JML_ATAN2_FAST.
+    @return atan2 @param y, @param x to within 1.2e-5, for one division and six multiplications.
+
+    */
+
+    inline Real _atan2Fast(Real y, Real x) {
+        Real ax = abs(x), ay = abs(y), hi = (ax > ay? ax : ay), lo = (ax > ay? ay : ax);
+        if (hi == 0) {
+            return 0;
+        }
+        Real a = lo / hi, s = a * a;
+        Real r = a * (Real(0.9998660) + s * (Real(-0.3302995) + s * (Real(0.1801410) + s * (Real(-0.0851330) + s * Real(0.0208351)))));
+        if (ay > ax) {
+            r = Real(JML_PIO2) - r;
+        }
+        if (x < 0) {
+            r = Real(JML_PI) - r;
+        }
+        return (y < 0? -r : r);
+    }
+
+    /**
+
+    @brief Angle of the direction ( @param x, @param y ) in the mode @param m.
+    @param m: JML_ATAN2_EXACT for the full precision atan, or JML_ATAN2_FAST for an error below 1.2e-5.
+    @return Angle in (-pi, pi], and 0 for the zero vector.
+
+    */
+
+    inline Real atan2(Real y, Real x, uint8_t m = JML_ATAN2_EXACT) {
+        if (m == JML_ATAN2_FAST) {
+            return _atan2Fast(y, x);
+        } else if (x > 0) {
             return atan(y / x);
         } else if (x < 0 && y >= 0) {
-            return atan(y / x) + JML_PI;
+            return atan(y / x) + Real(JML_PI);
         } else if (x < 0  && y < 0) {
-            return atan(y / x) - JML_PI;
+            return atan(y / x) - Real(JML_PI);
         } else if (x == 0 && y > 0) {
-            return JML_PIO2;
+            return Real(JML_PIO2);
         } else if (x == 0 && y < 0) {
-            return -JML_PIO2;
+            return -Real(JML_PIO2);
         } else {
             return 0;
         }
     }
 
-    inline long double tan(long double a) {
-        return sin(a) / cos(a);
+    /**
+
+    @brief Pseudo-angle of the direction ( @param x, @param y ): the position of the direction on the diamond |x| + |y| = 1.
+    It costs one division, and is strictly increasing in atan2 @param y, @param x, so it orders and compares directions the same way.
+    @return Pseudo-angle in (-2, 2] (which may round to -2 just below the negative x axis), where -1, 0, 1 and 2 are the angles -pi/2, 0, pi/2 and pi; 0 for the zero vector.
+
+    */
+
+    inline Real pseudoAngle(Real y, Real x) {
+        Real d = abs(x) + abs(y);
+        if (d == 0) {
+            return 0;
+        }
+        Real p = y / d;
+        if (x >= 0) {
+            return p;
+        }
+        return (y < 0? -2 : 2) - p;
+    }
+
+    inline Real tan(Real a) {
+        Real s, c;
+        sincos(a, s, c);
+        return s / c;
     }
 
-    inline long double cot(long double a) {
-        return 1.0L / tan(a);
+    inline Real cot(Real a) {
+        return Real(1.0) / tan(a);
     }
 
-    inline long double acot(long double a) {
-        return JML_PIO2 - atan(a);
+    inline Real acot(Real a) {
+        return Real(JML_PIO2) - atan(a);
     }
 
-    inline long double sec(long double a) {
-        return 1.0L / cos(a);
+    inline Real sec(Real a) {
+        return Real(1.0) / cos(a);
     }
 
-    inline long double asec(long double a) {
-        return acos(1.0L / a);
+    inline Real asec(Real a) {
+        return acos(Real(1.0) / a);
     }
 
-    inline long double csc(long double a) {
-        return 1.0L / sin(a);
+    inline Real csc(Real a) {
+        return Real(1.0) / sin(a);
     }
 
-    inline long double acsc(long double a) {
-        return JML_PIO2 - asec(a);
+    inline Real acsc(Real a) {
+        return Real(JML_PIO2) - asec(a);
     }
 
-    inline long double sigmoid(long double a) {
-        long double ex = jml::pow(JML_E, a);
-        return ex / (ex + 1);
+    //Each side takes e^-|a|, which underflows to 0 rather than overflowing.
+    inline Real sigmoid(Real a) {
+        if (a >= 0) {
+            return 1 / (1 + exp(-a));
+        }
+        Real ex = exp(a);
+        return ex / (1 + ex);
     }
 
-    inline long double tanh(long double a) {
-        return 2 * sigmoid(2 * a) - 1;
+    //tanh a = t / (t + 2) for t = e^2|a| - 1, on |a| clamped to 32, where tanh rounds to 1 in every precision.
+    inline Real tanh(Real a) {
+        Real z = abs(a);
+        Real t = expm1(2 * (z > 32? Real(32) : z));
+        return copysign(t / (t + 2), a);
     }
 
-    inline double toDegrees(double rads) {
-        return rads * 180.0L / JML_PI;
+    inline Real toDegrees(Real rads) {
+        return rads * Real(180.0) / Real(JML_PI);
     }
-    inline double toRadians(double degs) {
-        return degs * JML_PI / 180.0L;
+    inline Real toRadians(Real degs) {
+        return degs * Real(JML_PI) / Real(180.0);
     }
-    inline long double pi() {
-        return JML_PI;
+    inline Real pi() {
+        return Real(JML_PI);
     }
-    inline double epsilon() {
-        return JML_EPSILON;
+    inline Real epsilon() {
+        return Real(JML_EPSILON);
     }
-    inline long double phi() {
-        return JML_PHI;
+    inline Real phi() {
+        return Real(JML_PHI);
     }
     inline int64_t gcf(int64_t a, int64_t b) {
         int l = a, r  = b, an = l % r;
@@ -395,10 +436,13 @@ namespace jml {
         return l;
     }
 
-    inline long double fmod(long double b, long double m) {
-        long double z = b / m;
+    inline Real fmod(Real b, Real m) {
+        Real z = b / m;
         return (z - (int64_t)z) * m;
     }
 }
 
+#include <JML/batch.h>
+#include <JML/trigtable.h>
+
 #endif
\ No newline at end of file
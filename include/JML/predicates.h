@@ -0,0 +1,286 @@
+#ifndef JML_PREDICATES_H
+#define JML_PREDICATES_H
+
+/**
+
+@file       predicates.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements robust geometric predicates after Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates" (1997).
+
+orient2d(a, b, c) returns a value with the sign of the determinant | ax - cx, ay - cy; bx - cx, by - cy |, which is
+positive when a, b, c turn counterclockwise, negative when they turn clockwise, and zero exactly when they are collinear.
+cross2d(a, b, c, d) does the same for the cross product of the directions b - a and d - c, which is zero exactly when they are parallel.
+
+The determinant is first evaluated in plain double arithmetic. Only when its magnitude is below a proven error bound is it
+refined, in stages of increasing cost, with floating-point expansions (sums of non-overlapping doubles), so that the sign is
+always exact and degenerate inputs cost more than typical ones.
+
+Float inputs are exactly representable as doubles, and so are exact too. Long double inputs are rounded to double first.
+The expansion arithmetic requires that doubles are evaluated in double precision, as they are with SSE2, and not in the wider x87 registers.
+
+*/
+
+#include <JML/Expression.h>
+
+namespace jml {
+
+    ///Error bounds of the stages of orient2d, in units of the determinant's magnitude.
+    #define JML_ORIENT_EPSILON      1.1102230246251565404e-16
+    #define JML_ORIENT_BOUND_A      ((3 + 16 * JML_ORIENT_EPSILON) * JML_ORIENT_EPSILON)
+    #define JML_ORIENT_BOUND_B      ((2 + 12 * JML_ORIENT_EPSILON) * JML_ORIENT_EPSILON)
+    #define JML_ORIENT_BOUND_C      ((9 + 64 * JML_ORIENT_EPSILON) * JML_ORIENT_EPSILON * JML_ORIENT_EPSILON)
+    #define JML_ORIENT_BOUND_RESULT ((3 + 8 * JML_ORIENT_EPSILON) * JML_ORIENT_EPSILON)
+
+    ///Writes x = fl(a + b) and the roundoff y, so that a + b = x + y exactly, for |a| >= |b|.
+    inline void _fastTwoSum(double a, double b, double &x, double &y) {
+        x = a + b;
+        y = b - (x - a);
+    }
+
+    ///Writes x = fl(a + b) and the roundoff y, so that a + b = x + y exactly.
+    inline void _twoSum(double a, double b, double &x, double &y) {
+        x = a + b;
+        double bv = x - a, av = x - bv;
+        y = (a - av) + (b - bv);
+    }
+
+    ///@return The roundoff y of x = fl(a - b), so that a - b = x + y exactly.
+    inline double _twoDiffTail(double a, double b, double x) {
+        double bv = a - x, av = x + bv;
+        return (a - av) + (bv - b);
+    }
+
+    inline void _twoDiff(double a, double b, double &x, double &y) {
+        x = a - b;
+        y = _twoDiffTail(a, b, x);
+    }
+
+    ///Splits @param a into the 26-bit halves @param hi and @param lo, so that a = hi + lo and products of halves are exact.
+    inline void _split(double a, double &hi, double &lo) {
+        double c = 134217729.0 * a;
+        hi = c - (c - a);
+        lo = a - hi;
+    }
+
+    /**
+
+    @brief Writes x = fl(a * b) and the roundoff y, so that a * b = x + y exactly.
+    Where the target has a fused multiply-add the compiler may contract the split products into it, which breaks their exactness,
+    so there the roundoff is taken from the fused multiply-add itself.
+
+    */
+
+    inline void _twoProduct(double a, double b, double &x, double &y) {
+        x = a * b;
+        #if defined(__GNUC__) && defined(__FP_FAST_FMA)
+        y = __builtin_fma(a, b, -x);
+        #else
+        double ah, al, bh, bl;
+        _split(a, ah, al);
+        _split(b, bh, bl);
+        y = al * bl - (((x - ah * bh) - al * bh) - ah * bl);
+        #endif
+    }
+
+    ///Writes the expansion x of (a1 + a0) - (b1 + b0), least significant component first.
+    inline void _twoTwoDiff(double a1, double a0, double b1, double b0, double *x) {
+        double i, j, k;
+        _twoDiff(a0, b0, i, x[0]);
+        _twoSum(a1, i, j, k);
+        _twoDiff(k, b1, i, x[1]);
+        _twoSum(j, i, x[3], x[2]);
+    }
+
+    /**
+
+    @brief Writes the sum of the expansions @param e and @param f to @param h, dropping zero components.
+    @param h must have room for @param ne + @param nf components, and may not alias either input.
+    @return Number of components written.
+
+    */
+
+    inline size_t _expansionSum(size_t ne, const double *e, size_t nf, const double *f, double *h) {
+        size_t i = 0, j = 0, n = 0;
+        double q, qn, hh;
+        //Takes the components in order of increasing magnitude.
+        auto next = [&]() -> double {
+            if (j >= nf || (i < ne && ((f[j] > e[i]) == (f[j] > -e[i])))) {
+                return e[i++];
+            }
+            return f[j++];
+        };
+        q = next();
+        if (i < ne && j < nf) {
+            _fastTwoSum(next(), q, qn, hh);
+            q = qn;
+            if (hh != 0) {
+                h[n++] = hh;
+            }
+        }
+        while (i < ne || j < nf) {
+            _twoSum(q, next(), qn, hh);
+            q = qn;
+            if (hh != 0) {
+                h[n++] = hh;
+            }
+        }
+        if (q != 0 || n == 0) {
+            h[n++] = q;
+        }
+        return n;
+    }
+
+    ///Refines the determinant of orient2d once the plain evaluation could not decide its sign.
+    inline double _orient2dAdapt(double ax, double ay, double bx, double by, double cx, double cy, double detsum) {
+        double acx = ax - cx, bcx = bx - cx, acy = ay - cy, bcy = by - cy;
+        double l, lt, r, rt, B[4];
+        _twoProduct(acx, bcy, l, lt);
+        _twoProduct(acy, bcx, r, rt);
+        _twoTwoDiff(l, lt, r, rt, B);
+        double det = B[0] + B[1] + B[2] + B[3];
+        double bound = JML_ORIENT_BOUND_B * detsum;
+        if (det >= bound || -det >= bound) {
+            return det;
+        }
+
+        double acxt = _twoDiffTail(ax, cx, acx), bcxt = _twoDiffTail(bx, cx, bcx);
+        double acyt = _twoDiffTail(ay, cy, acy), bcyt = _twoDiffTail(by, cy, bcy);
+        if (acxt == 0 && acyt == 0 && bcxt == 0 && bcyt == 0) {
+            return det;
+        }
+        bound = JML_ORIENT_BOUND_C * detsum + JML_ORIENT_BOUND_RESULT * (det < 0? -det : det);
+        det += (acx * bcyt + bcy * acxt) - (acy * bcxt + bcx * acyt);
+        if (det >= bound || -det >= bound) {
+            return det;
+        }
+
+        double u[4], C1[8], C2[12], D[16];
+        _twoProduct(acxt, bcy, l, lt);
+        _twoProduct(acyt, bcx, r, rt);
+        _twoTwoDiff(l, lt, r, rt, u);
+        size_t n1 = _expansionSum(4, B, 4, u, C1);
+        _twoProduct(acx, bcyt, l, lt);
+        _twoProduct(acy, bcxt, r, rt);
+        _twoTwoDiff(l, lt, r, rt, u);
+        size_t n2 = _expansionSum(n1, C1, 4, u, C2);
+        _twoProduct(acxt, bcyt, l, lt);
+        _twoProduct(acyt, bcxt, r, rt);
+        _twoTwoDiff(l, lt, r, rt, u);
+        size_t n3 = _expansionSum(n2, C2, 4, u, D);
+        return D[n3 - 1];
+    }
+
+    /**
+
+    @brief Orientation of the points a, b and c, exact for every input.
+    @return Positive if a, b, c turn counterclockwise, negative if clockwise and 0 if they are collinear.
+    The magnitude approximates twice the signed area of the triangle.
+
+    */
+
+    inline double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+        double l = (ax - cx) * (by - cy), r = (ay - cy) * (bx - cx), det = l - r, detsum;
+        if (l > 0) {
+            if (r <= 0) {
+                return det;
+            }
+            detsum = l + r;
+        } else if (l < 0) {
+            if (r >= 0) {
+                return det;
+            }
+            detsum = -l - r;
+        } else {
+            return det;
+        }
+        double bound = JML_ORIENT_BOUND_A * detsum;
+        if (det >= bound || -det >= bound) {
+            return det;
+        }
+        return _orient2dAdapt(ax, ay, bx, by, cx, cy, detsum);
+    }
+
+    /**
+
+    @brief Writes the exact expansion of the cross product (b - a) x (d - c) to @param h, which has room for 16 components.
+    Each difference is exactly a pair of doubles, so the cross product is exactly a sum of 8 products of doubles.
+    @return Number of components written.
+
+    */
+
+    inline size_t _crossExpansion(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy, double *h) {
+        double ux = bx - ax, uy = by - ay, vx = dx - cx, vy = dy - cy;
+        double u[2][2] = {{_twoDiffTail(bx, ax, ux), ux}, {_twoDiffTail(by, ay, uy), uy}};
+        double v[2][2] = {{_twoDiffTail(dx, cx, vx), vx}, {_twoDiffTail(dy, cy, vy), vy}};
+        double g[16], p[2];
+        size_t n = 0;
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 2; ++j) {
+                _twoProduct(u[0][i], v[1][j], p[1], p[0]);
+                n = _expansionSum(n, h, 2, p, g);
+                _twoProduct(-u[1][i], v[0][j], p[1], p[0]);
+                n = _expansionSum(n, g, 2, p, h);
+            }
+        }
+        return n;
+    }
+
+    /**
+
+    @brief Cross product of the directions b - a and d - c, exact in sign for every input.
+    @return Positive if d - c points counterclockwise of b - a, negative if clockwise and 0 if they are parallel.
+    orient2d(a, b, c) is the special case cross2d(c, a, c, b).
+
+    */
+
+    inline double cross2d(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        double l = (bx - ax) * (dy - cy), r = (by - ay) * (dx - cx), det = l - r;
+        double bound = JML_ORIENT_BOUND_A * ((l < 0? -l : l) + (r < 0? -r : r));
+        if (det > bound || -det > bound) {
+            return det;
+        }
+        double h[16];
+        return h[_crossExpansion(ax, ay, bx, by, cx, cy, dx, dy, h) - 1];
+    }
+
+    /**
+
+    @brief Cross product of the directions b - a and d - c, to a relative error of a few units in the last place for every input.
+    cross2d only guarantees the sign, which is enough for predicates but not for the constructions, such as intersection points, which divide by it.
+
+    */
+
+    inline double _cross2dValue(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        double l = (bx - ax) * (dy - cy), r = (by - ay) * (dx - cx), det = l - r;
+        //Without cancellation the plain evaluation is accurate to about 2^10 * 3 units in the last place.
+        if ((det < 0? -det : det) * 1024 >= (l < 0? -l : l) + (r < 0? -r : r)) {
+            return det;
+        }
+        double h[16], sum = 0;
+        size_t n = _crossExpansion(ax, ay, bx, by, cx, cy, dx, dy, h);
+        for (size_t i = 0; i < n; ++i) {
+            sum += h[i];
+        }
+        return sum;
+    }
+
+    ///@return orient2d of the first two components of the vectors @param a, @param b and @param c.
+    template <typename A, typename B, typename C>
+    inline double orient2d(const VectorExpression<A> &a, const VectorExpression<B> &b, const VectorExpression<C> &c) {
+        static_assert(A::nLength >= 2 && B::nLength >= 2 && C::nLength >= 2, "Orienting vectors of fewer than 2 components.");
+        const A &ea = a.self();
+        const B &eb = b.self();
+        const C &ec = c.self();
+        return orient2d(
+            static_cast<double>(ea.get(0)), static_cast<double>(ea.get(1)),
+            static_cast<double>(eb.get(0)), static_cast<double>(eb.get(1)),
+            static_cast<double>(ec.get(0)), static_cast<double>(ec.get(1))
+        );
+    }
+}
+
+#endif // JML_PREDICATES_H
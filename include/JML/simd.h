@@ -0,0 +1,390 @@
+#ifndef JML_SIMD_H
+#define JML_SIMD_H
+
+/**
+
+@file       simd.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Vectorized kernels for 4-wide float and double data, selected at compile time from the instruction sets the compiler targets.
+Also defines _Pack, a register of doubles with arithmetic operators, on which the batch kernels of batch.h are written.
+
+AVX is used when available, then SSE2, and a scalar loop otherwise. Define JML_NO_SIMD to force the scalar kernels.
+Matrices are 16 contiguous values in row-major order.
+
+*/
+
+#include <JML/constants.h>
+
+#ifndef JML_NO_SIMD
+    #if defined(__AVX__)
+        #define JML_AVX
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define JML_SSE2
+    #endif
+#endif
+
+#if defined(JML_AVX)
+    #include <immintrin.h>
+#elif defined(JML_SSE2)
+    #include <emmintrin.h>
+#endif
+
+namespace jml {
+
+    #if defined(JML_SSE2)
+
+    inline float _hsum(__m128 v) {
+        __m128 s = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        s = _mm_add_ss(s, _mm_movehl_ps(s, s));
+        return _mm_cvtss_f32(s);
+    }
+
+    inline double _hsum(__m128d lo, __m128d hi) {
+        __m128d s = _mm_add_pd(lo, hi);
+        s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+        return _mm_cvtsd_f64(s);
+    }
+
+    #endif
+
+    ///@return Dot product of the 4-element arrays @param a and @param b.
+    inline float _dot4(const float *a, const float *b) {
+        #if defined(JML_SSE2)
+        return _hsum(_mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+        #else
+        return (a[0] * b[0] + a[1] * b[1]) + (a[2] * b[2] + a[3] * b[3]);
+        #endif
+    }
+
+    inline double _dot4(const double *a, const double *b) {
+        #if defined(JML_SSE2)
+        return _hsum(_mm_mul_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)), _mm_mul_pd(_mm_loadu_pd(a + 2), _mm_loadu_pd(b + 2)));
+        #else
+        return (a[0] * b[0] + a[1] * b[1]) + (a[2] * b[2] + a[3] * b[3]);
+        #endif
+    }
+
+    ///Writes the product of the 4x4 matrix @param m and the 4-element vector @param v to @param r.
+    inline void _mulMat4Vec4(const float *m, const float *v, float *r) {
+        #if defined(JML_SSE2)
+        __m128 x = _mm_loadu_ps(v);
+        __m128 r0 = _mm_mul_ps(_mm_loadu_ps(m), x);
+        __m128 r1 = _mm_mul_ps(_mm_loadu_ps(m + 4), x);
+        __m128 r2 = _mm_mul_ps(_mm_loadu_ps(m + 8), x);
+        __m128 r3 = _mm_mul_ps(_mm_loadu_ps(m + 12), x);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(r, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+        #else
+        for (size_t i = 0; i < 4; ++i) {
+            r[i] = _dot4(m + i * 4, v);
+        }
+        #endif
+    }
+
+    inline void _mulMat4Vec4(const double *m, const double *v, double *r) {
+        #if defined(JML_AVX)
+        __m256d x = _mm256_loadu_pd(v);
+        __m256d r0 = _mm256_mul_pd(_mm256_loadu_pd(m), x);
+        __m256d r1 = _mm256_mul_pd(_mm256_loadu_pd(m + 4), x);
+        __m256d r2 = _mm256_mul_pd(_mm256_loadu_pd(m + 8), x);
+        __m256d r3 = _mm256_mul_pd(_mm256_loadu_pd(m + 12), x);
+        __m256d s01 = _mm256_hadd_pd(r0, r1);
+        __m256d s23 = _mm256_hadd_pd(r2, r3);
+        __m256d lo = _mm256_permute2f128_pd(s01, s23, 0x20);
+        __m256d hi = _mm256_permute2f128_pd(s01, s23, 0x31);
+        _mm256_storeu_pd(r, _mm256_add_pd(lo, hi));
+        #else
+        for (size_t i = 0; i < 4; ++i) {
+            r[i] = _dot4(m + i * 4, v);
+        }
+        #endif
+    }
+
+    ///Writes the product of the 4x4 matrices @param a and @param b to @param r, which may not alias either input.
+    inline void _mulMat4Mat4(const float *a, const float *b, float *r) {
+        #if defined(JML_AVX)
+        __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b));
+        __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+        __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+        __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+        for (size_t i = 0; i < 16; i += 8) {
+            __m256 rows = _mm256_loadu_ps(a + i);
+            __m256 c = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x00), b0);
+            c = _mm256_add_ps(c, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x55), b1));
+            c = _mm256_add_ps(c, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xaa), b2));
+            c = _mm256_add_ps(c, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xff), b3));
+            _mm256_storeu_ps(r + i, c);
+        }
+        #elif defined(JML_SSE2)
+        __m128 b0 = _mm_loadu_ps(b);
+        __m128 b1 = _mm_loadu_ps(b + 4);
+        __m128 b2 = _mm_loadu_ps(b + 8);
+        __m128 b3 = _mm_loadu_ps(b + 12);
+        for (size_t i = 0; i < 16; i += 4) {
+            __m128 c = _mm_mul_ps(_mm_set1_ps(a[i]), b0);
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[i + 1]), b1));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[i + 2]), b2));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[i + 3]), b3));
+            _mm_storeu_ps(r + i, c);
+        }
+        #else
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                r[i * 4 + j] = a[i * 4] * b[j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + a[i * 4 + 3] * b[12 + j];
+            }
+        }
+        #endif
+    }
+
+    inline void _mulMat4Mat4(const double *a, const double *b, double *r) {
+        #if defined(JML_AVX)
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d b2 = _mm256_loadu_pd(b + 8);
+        __m256d b3 = _mm256_loadu_pd(b + 12);
+        for (size_t i = 0; i < 16; i += 4) {
+            __m256d c = _mm256_mul_pd(_mm256_broadcast_sd(a + i), b0);
+            c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_broadcast_sd(a + i + 1), b1));
+            c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_broadcast_sd(a + i + 2), b2));
+            c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_broadcast_sd(a + i + 3), b3));
+            _mm256_storeu_pd(r + i, c);
+        }
+        #elif defined(JML_SSE2)
+        for (size_t i = 0; i < 16; i += 4) {
+            __m128d lo = _mm_setzero_pd(), hi = _mm_setzero_pd();
+            for (size_t k = 0; k < 4; ++k) {
+                __m128d s = _mm_set1_pd(a[i + k]);
+                lo = _mm_add_pd(lo, _mm_mul_pd(s, _mm_loadu_pd(b + k * 4)));
+                hi = _mm_add_pd(hi, _mm_mul_pd(s, _mm_loadu_pd(b + k * 4 + 2)));
+            }
+            _mm_storeu_pd(r + i, lo);
+            _mm_storeu_pd(r + i + 2, hi);
+        }
+        #else
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                r[i * 4 + j] = a[i * 4] * b[j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + a[i * 4 + 3] * b[12 + j];
+            }
+        }
+        #endif
+    }
+
+    /**
+
+    @brief Writes the product of the affine 3x4 blocks @param a and @param b to @param r, which may not alias either input. @see Affine.h
+    Each row of r is a row of a times the rows of b, plus the translation of a in the last column.
+
+    */
+
+    inline void _mulAffine3(const float *a, const float *b, float *r) {
+        #if defined(JML_SSE2)
+        __m128 b0 = _mm_loadu_ps(b);
+        __m128 b1 = _mm_loadu_ps(b + 4);
+        __m128 b2 = _mm_loadu_ps(b + 8);
+        __m128 last = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+        for (size_t i = 0; i < 12; i += 4) {
+            __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[i]), b0), _mm_and_ps(_mm_loadu_ps(a + i), last));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[i + 1]), b1));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(a[i + 2]), b2));
+            _mm_storeu_ps(r + i, c);
+        }
+        #else
+        for (size_t i = 0; i < 12; i += 4) {
+            for (size_t j = 0; j < 4; ++j) {
+                r[i + j] = a[i] * b[j] + a[i + 1] * b[4 + j] + a[i + 2] * b[8 + j] + (j == 3? a[i + 3] : 0);
+            }
+        }
+        #endif
+    }
+
+    inline void _mulAffine3(const double *a, const double *b, double *r) {
+        #if defined(JML_AVX)
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d b2 = _mm256_loadu_pd(b + 8);
+        for (size_t i = 0; i < 12; i += 4) {
+            __m256d c = _mm256_add_pd(_mm256_mul_pd(_mm256_broadcast_sd(a + i), b0), _mm256_set_pd(a[i + 3], 0, 0, 0));
+            c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_broadcast_sd(a + i + 1), b1));
+            c = _mm256_add_pd(c, _mm256_mul_pd(_mm256_broadcast_sd(a + i + 2), b2));
+            _mm256_storeu_pd(r + i, c);
+        }
+        #elif defined(JML_SSE2)
+        for (size_t i = 0; i < 12; i += 4) {
+            __m128d lo = _mm_setzero_pd(), hi = _mm_set_pd(a[i + 3], 0);
+            for (size_t k = 0; k < 3; ++k) {
+                __m128d s = _mm_set1_pd(a[i + k]);
+                lo = _mm_add_pd(lo, _mm_mul_pd(s, _mm_loadu_pd(b + k * 4)));
+                hi = _mm_add_pd(hi, _mm_mul_pd(s, _mm_loadu_pd(b + k * 4 + 2)));
+            }
+            _mm_storeu_pd(r + i, lo);
+            _mm_storeu_pd(r + i + 2, hi);
+        }
+        #else
+        for (size_t i = 0; i < 12; i += 4) {
+            for (size_t j = 0; j < 4; ++j) {
+                r[i + j] = a[i] * b[j] + a[i + 1] * b[4 + j] + a[i + 2] * b[8 + j] + (j == 3? a[i + 3] : 0);
+            }
+        }
+        #endif
+    }
+
+    #if defined(JML_SSE2)
+
+    /**
+
+    @brief Lane-wise operations on a register of doubles, so that the kernels built on _Pack are written once for every register width.
+    @param n: Number of lanes in the register.
+
+    */
+
+    template <size_t n>
+    struct _LaneOps;
+
+    template <>
+    struct _LaneOps<2> {
+        typedef __m128d Register;
+
+        static __m128d set1(double a) {return _mm_set1_pd(a);}
+        static __m128d load(const double *p) {return _mm_loadu_pd(p);}
+        static __m128d load(const float *p) {return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));}
+        static void store(double *p, __m128d v) {_mm_storeu_pd(p, v);}
+        static void store(float *p, __m128d v) {_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(v)));}
+
+        static __m128d add(__m128d a, __m128d b) {return _mm_add_pd(a, b);}
+        static __m128d sub(__m128d a, __m128d b) {return _mm_sub_pd(a, b);}
+        static __m128d mul(__m128d a, __m128d b) {return _mm_mul_pd(a, b);}
+        static __m128d div(__m128d a, __m128d b) {return _mm_div_pd(a, b);}
+        static __m128d sqrt(__m128d a) {return _mm_sqrt_pd(a);}
+
+        static __m128d bitAnd(__m128d a, __m128d b) {return _mm_and_pd(a, b);}
+        static __m128d bitAndNot(__m128d a, __m128d b) {return _mm_andnot_pd(a, b);}
+        static __m128d bitOr(__m128d a, __m128d b) {return _mm_or_pd(a, b);}
+        static __m128d bitXor(__m128d a, __m128d b) {return _mm_xor_pd(a, b);}
+
+        static __m128d less(__m128d a, __m128d b) {return _mm_cmplt_pd(a, b);}
+        static __m128d lessEqual(__m128d a, __m128d b) {return _mm_cmple_pd(a, b);}
+        static int mask(__m128d m) {return _mm_movemask_pd(m);}
+
+        ///@return 2^k for the integral @param k in [-1022, 1023].
+        static __m128d pow2(__m128d k) {
+            __m128i b = _mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(4503599627370496.0 + 1023)));
+            return _mm_castsi128_pd(_mm_slli_epi64(b, 52));
+        }
+
+        ///@return Unbiased exponent of the positive, normal @param x.
+        static __m128d exponent(__m128d x) {
+            __m128i b = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            return _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(b), _mm_set1_pd(4503599627370496.0)), _mm_set1_pd(4503599627370496.0 + 1023));
+        }
+
+        ///@return Mantissa in [1, 2) of the positive, normal @param x.
+        static __m128d mantissa(__m128d x) {
+            return _mm_or_pd(_mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi64x(0x000fffffffffffffLL))), _mm_set1_pd(1));
+        }
+    };
+
+    #if defined(JML_AVX)
+
+    template <>
+    struct _LaneOps<4> {
+        typedef __m256d Register;
+
+        static __m256d set1(double a) {return _mm256_set1_pd(a);}
+        static __m256d load(const double *p) {return _mm256_loadu_pd(p);}
+        static __m256d load(const float *p) {return _mm256_cvtps_pd(_mm_loadu_ps(p));}
+        static void store(double *p, __m256d v) {_mm256_storeu_pd(p, v);}
+        static void store(float *p, __m256d v) {_mm_storeu_ps(p, _mm256_cvtpd_ps(v));}
+
+        static __m256d add(__m256d a, __m256d b) {return _mm256_add_pd(a, b);}
+        static __m256d sub(__m256d a, __m256d b) {return _mm256_sub_pd(a, b);}
+        static __m256d mul(__m256d a, __m256d b) {return _mm256_mul_pd(a, b);}
+        static __m256d div(__m256d a, __m256d b) {return _mm256_div_pd(a, b);}
+        static __m256d sqrt(__m256d a) {return _mm256_sqrt_pd(a);}
+
+        static __m256d bitAnd(__m256d a, __m256d b) {return _mm256_and_pd(a, b);}
+        static __m256d bitAndNot(__m256d a, __m256d b) {return _mm256_andnot_pd(a, b);}
+        static __m256d bitOr(__m256d a, __m256d b) {return _mm256_or_pd(a, b);}
+        static __m256d bitXor(__m256d a, __m256d b) {return _mm256_xor_pd(a, b);}
+
+        static __m256d less(__m256d a, __m256d b) {return _mm256_cmp_pd(a, b, _CMP_LT_OQ);}
+        static __m256d lessEqual(__m256d a, __m256d b) {return _mm256_cmp_pd(a, b, _CMP_LE_OQ);}
+        static int mask(__m256d m) {return _mm256_movemask_pd(m);}
+
+        //AVX has no 256-bit integer shifts, so the bit manipulations run on each half.
+        static __m256d pow2(__m256d k) {return halves<_LaneOps<2>::pow2>(k);}
+        static __m256d exponent(__m256d x) {return halves<_LaneOps<2>::exponent>(x);}
+        static __m256d mantissa(__m256d x) {return halves<_LaneOps<2>::mantissa>(x);}
+
+    private:
+        template <__m128d (*F)(__m128d)>
+        static __m256d halves(__m256d v) {
+            return _mm256_insertf128_pd(_mm256_castpd128_pd256(F(_mm256_castpd256_pd128(v))), F(_mm256_extractf128_pd(v, 1)), 1);
+        }
+    };
+
+    #endif
+
+    /**
+
+    @brief A register of doubles with arithmetic operators, so that scalar polynomial kernels can be instantiated on it unchanged.
+    @param n: Number of lanes in the register.
+
+    */
+
+    template <size_t n>
+    struct _Pack {
+        typedef _LaneOps<n> Ops;
+        typedef typename Ops::Register V;
+        enum {Width = n};
+
+        V v;
+
+        _Pack() {}
+        _Pack(V a) : v(a) {}
+        _Pack(double a) : v(Ops::set1(a)) {}
+
+        template <typename T>
+        static _Pack load(const T *p) {return Ops::load(p);}
+        template <typename T>
+        void store(T *p) const {Ops::store(p, v);}
+
+        friend _Pack operator+(const _Pack &a, const _Pack &b) {return Ops::add(a.v, b.v);}
+        friend _Pack operator-(const _Pack &a, const _Pack &b) {return Ops::sub(a.v, b.v);}
+        friend _Pack operator*(const _Pack &a, const _Pack &b) {return Ops::mul(a.v, b.v);}
+        friend _Pack operator/(const _Pack &a, const _Pack &b) {return Ops::div(a.v, b.v);}
+        friend _Pack operator-(const _Pack &a) {return Ops::bitXor(a.v, Ops::set1(-0.0));}
+        friend _Pack operator&(const _Pack &a, const _Pack &b) {return Ops::bitAnd(a.v, b.v);}
+        friend _Pack operator|(const _Pack &a, const _Pack &b) {return Ops::bitOr(a.v, b.v);}
+
+        ///@return Mask of the lanes where @param a < @param b, or <= with lessEqual.
+        static _Pack less(const _Pack &a, const _Pack &b) {return Ops::less(a.v, b.v);}
+        static _Pack lessEqual(const _Pack &a, const _Pack &b) {return Ops::lessEqual(a.v, b.v);}
+        ///@return Bit i set for each lane i set in the mask @param m.
+        static int mask(const _Pack &m) {return Ops::mask(m.v);}
+        ///@return @param a in the lanes set in the mask @param m, and @param b elsewhere.
+        static _Pack select(const _Pack &m, const _Pack &a, const _Pack &b) {return Ops::bitOr(Ops::bitAnd(m.v, a.v), Ops::bitAndNot(m.v, b.v));}
+
+        static _Pack abs(const _Pack &a) {return Ops::bitAndNot(Ops::set1(-0.0), a.v);}
+        ///@return @param a with the sign of @param b.
+        static _Pack copysign(const _Pack &a, const _Pack &b) {return Ops::bitOr(abs(a).v, Ops::bitAnd(Ops::set1(-0.0), b.v));}
+        static _Pack sqrt(const _Pack &a) {return Ops::sqrt(a.v);}
+        ///@return @param a rounded to the nearest integer, for |a| < 2^51.
+        static _Pack round(const _Pack &a) {
+            const V m = Ops::set1(6755399441055744.0);
+            return Ops::sub(Ops::add(a.v, m), m);
+        }
+
+        static _Pack pow2(const _Pack &k) {return Ops::pow2(k.v);}
+        static _Pack exponent(const _Pack &a) {return Ops::exponent(a.v);}
+        static _Pack mantissa(const _Pack &a) {return Ops::mantissa(a.v);}
+    };
+
+    #endif
+}
+
+#endif // JML_SIMD_H
@@ -0,0 +1,188 @@
+#ifndef JML_SORTING_H
+#define JML_SORTING_H
+
+/**
+
+@file       sorting.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the partition, selection and heap routines behind the builds and queries of BVH.h and KDTree.h,
+over ranges of pointers [b, e) such as those of a jutil::Queue, so that the library needs nothing from <algorithm>.
+
+Comparisons are made by a function object less(x, y), which must be a strict weak ordering, as for the standard library.
+
+_nthElement() is a quickselect which partitions around the median of three and splits runs of equal keys evenly.
+Past 2 log n partitions it selects by a heap instead, so its cost is linear on average and n log n at worst.
+
+*/
+
+#include <JML/dependencies.h>
+
+namespace jml {
+
+    ///Orders by operator<.
+    struct _Less {
+        template <typename T>
+        bool operator()(const T &a, const T &b) const {
+            return a < b;
+        }
+    };
+
+    template <typename T>
+    inline void _swap(T &a, T &b) {
+        T t = a;
+        a = b;
+        b = t;
+    }
+
+    /**
+
+    @brief Moves the elements of [ @param b, @param e ) for which @param p holds in front of those for which it doesn't.
+    @return The first element for which @param p doesn't hold.
+
+    */
+
+    template <typename T, typename F>
+    T *_partition(T *b, T *e, F p) {
+        while (true) {
+            while (b != e && p(*b)) {
+                ++b;
+            }
+            do {
+                if (b == e) return b;
+                --e;
+            } while (!p(*e));
+            _swap(*b, *e);
+            ++b;
+        }
+    }
+
+    ///@brief Sifts the element at @param i of the heap [ @param b, @param b + @param n ) down to its place.
+    template <typename T, typename F>
+    void _siftDown(T *b, size_t i, size_t n, F less) {
+        T v = b[i];
+        for (size_t c = 2 * i + 1; c < n; c = 2 * i + 1) {
+            if (c + 1 < n && less(b[c], b[c + 1])) {
+                ++c;
+            }
+            if (!less(v, b[c])) break;
+            b[i] = b[c];
+            i = c;
+        }
+        b[i] = v;
+    }
+
+    ///@brief Adds the last element of [ @param b, @param e ) to the max-heap formed by the others.
+    template <typename T, typename F>
+    void _pushHeap(T *b, T *e, F less) {
+        size_t i = static_cast<size_t>(e - b) - 1;
+        T v = b[i];
+        while (i > 0 && less(b[(i - 1) / 2], v)) {
+            b[i] = b[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        b[i] = v;
+    }
+
+    ///@brief Moves the greatest element of the max-heap [ @param b, @param e ) to its end, leaving the rest a heap.
+    template <typename T, typename F>
+    void _popHeap(T *b, T *e, F less) {
+        size_t n = static_cast<size_t>(e - b) - 1;
+        _swap(b[0], b[n]);
+        if (n > 1) {
+            _siftDown(b, 0, n, less);
+        }
+    }
+
+    template <typename T, typename F>
+    void _makeHeap(T *b, T *e, F less) {
+        size_t n = static_cast<size_t>(e - b);
+        for (size_t i = n / 2; i-- > 0;) {
+            _siftDown(b, i, n, less);
+        }
+    }
+
+    ///@brief Sorts the max-heap [ @param b, @param e ) in ascending order.
+    template <typename T, typename F>
+    void _sortHeap(T *b, T *e, F less) {
+        for (; e - b > 1; --e) {
+            _popHeap(b, e, less);
+        }
+    }
+
+    template <typename T>
+    void _pushHeap(T *b, T *e) {
+        _pushHeap(b, e, _Less());
+    }
+
+    template <typename T>
+    void _popHeap(T *b, T *e) {
+        _popHeap(b, e, _Less());
+    }
+
+    template <typename T>
+    void _sortHeap(T *b, T *e) {
+        _sortHeap(b, e, _Less());
+    }
+
+    /**
+
+    @brief Rearranges [ @param b, @param e ) so that @param m holds the element it would hold if the range were sorted,
+    with no element after it less than it and no element before it greater.
+
+    */
+
+    template <typename T, typename F>
+    void _nthElement(T *b, T *m, T *e, F less) {
+        size_t limit = 0;
+        for (size_t n = static_cast<size_t>(e - b); n > 1; n >>= 1) {
+            limit += 2;
+        }
+        while (e - b > 3) {
+            if (!limit--) {
+                //The smallest m - b + 1 elements are gathered in a max-heap whose top is then the one sought.
+                _makeHeap(b, m + 1, less);
+                for (T *i = m + 1; i != e; ++i) {
+                    if (less(*i, *b)) {
+                        _swap(*i, *b);
+                        _siftDown(b, 0, static_cast<size_t>(m + 1 - b), less);
+                    }
+                }
+                _popHeap(b, m + 1, less);
+                return;
+            }
+            //The median of the first, middle and last elements is moved to the front as the pivot.
+            T *c = b + (e - b) / 2, *l = e - 1;
+            if (less(*c, *b)) _swap(*c, *b);
+            if (less(*l, *c)) _swap(*l, *c);
+            if (less(*c, *b)) _swap(*c, *b);
+            _swap(*b, *c);
+            //Both scans stop at keys equal to the pivot, so runs of equal keys are split evenly.
+            T *i = b, *j = e;
+            while (true) {
+                while (less(*++i, *b)) {}
+                while (less(*b, *--j)) {}
+                if (i >= j) break;
+                _swap(*i, *j);
+            }
+            _swap(*b, *j);
+            if (j == m) return;
+            if (m < j) {
+                e = j;
+            } else {
+                b = j + 1;
+            }
+        }
+        //At most 3 elements remain, which are sorted in place.
+        for (T *i = b + 1; i < e; ++i) {
+            for (T *k = i; k != b && less(*k, *(k - 1)); --k) {
+                _swap(*k, *(k - 1));
+            }
+        }
+    }
+}
+
+#endif // JML_SORTING_H
@@ -0,0 +1,218 @@
+#ifndef JML_SQRT_H
+#define JML_SQRT_H
+
+/**
+
+@file       sqrt.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the square root kernels behind jml::sqrt and jml::rsqrt, for single values and for arrays.
+
+Each kernel has two modes:
+    JML_SQRT_EXACT: The hardware square root, correctly rounded.
+    JML_SQRT_FAST:  The hardware reciprocal square root estimate refined by one Newton step, with a relative error below 2^-21.
+                    Without SSE the estimate comes from the exponent bits instead, and takes two Newton steps to reach 5e-6.
+
+Without the hardware instruction or a compiler builtin, the exact mode falls back to Newton's method on the mantissa.
+
+*/
+
+#include <JML/simd.h>
+#include <JML/explog.h>
+
+namespace jml {
+
+    ///@return sqrt @param x by Newton's method, for any floating point type.
+    template <typename T>
+    T _sqrt(T x) {
+        if (!(x > 0) || !(x - x == 0)) {
+            return (x < 0? (x - x) / (x - x) : x);
+        }
+        long e;
+        T m = _frexp(x, e);
+        if (e & 1) {
+            m *= 2;
+            --e;
+        }
+        T y = (1 + m) / 2;
+        for (size_t i = 0; i < 6; ++i) {
+            y = (y + m / y) / 2;
+        }
+        return _ldexp(y, e / 2);
+    }
+
+    #if defined(JML_SSE2)
+
+    inline float _sqrt(float x) {
+        return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+    }
+
+    inline double _sqrt(double x) {
+        __m128d v = _mm_set_sd(x);
+        return _mm_cvtsd_f64(_mm_sqrt_sd(v, v));
+    }
+
+    #elif defined(__GNUC__)
+
+    inline float _sqrt(float x) {
+        return __builtin_sqrtf(x);
+    }
+
+    inline double _sqrt(double x) {
+        return __builtin_sqrt(x);
+    }
+
+    #endif
+
+    #if defined(__GNUC__)
+
+    inline long double _sqrt(long double x) {
+        return __builtin_sqrtl(x);
+    }
+
+    #endif
+
+    ///@return Estimate of 1 / sqrt @param x with a relative error below 1.5 * 2^-12, or 5e-6 without SSE.
+    inline float _rsqrtEstimate(float x) {
+        #if defined(JML_SSE2)
+        return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        #else
+        union {
+            float x;
+            uint32_t i;
+        } u;
+        u.x = x;
+        u.i = 0x5f375a86 - (u.i >> 1);
+        return u.x * (1.5f - 0.5f * x * u.x * u.x);
+        #endif
+    }
+
+    ///@return 1 / sqrt @param x, to within the error of JML_SQRT_FAST.
+    template <typename T>
+    T _rsqrtFast(T x) {
+        if (!(x > static_cast<T>(1e-37) && x < static_cast<T>(1e37))) {
+            return 1 / _sqrt(x);
+        }
+        T y = static_cast<T>(_rsqrtEstimate(static_cast<float>(x)));
+        return y * (static_cast<T>(1.5) - static_cast<T>(0.5) * x * y * y);
+    }
+
+    ///@return sqrt @param x in the mode @param m.
+    template <typename T>
+    T _sqrtMode(T x, uint8_t m) {
+        //0 and infinity are their own roots, where x * (1 / sqrt x) would be 0 * inf.
+        if (m == JML_SQRT_FAST && x != 0 && x - x == 0) {
+            return x * _rsqrtFast(x);
+        }
+        return _sqrt(x);
+    }
+
+    ///@return 1 / sqrt @param x in the mode @param m.
+    template <typename T>
+    T _rsqrtMode(T x, uint8_t m) {
+        return (m == JML_SQRT_FAST? _rsqrtFast(x) : 1 / _sqrt(x));
+    }
+
+    /**
+
+    @brief Writes sqrt (or 1 / sqrt, if @param inverse) of the @param n values at @param x to @param r in the mode @param m.
+    @param r may be the same array as @param x.
+
+    */
+
+    template <typename T>
+    void _sqrtArray(const T *x, T *r, size_t n, uint8_t m, bool inverse) {
+        for (size_t i = 0; i < n; ++i) {
+            r[i] = (inverse? _rsqrtMode(x[i], m) : _sqrtMode(x[i], m));
+        }
+    }
+
+    #if defined(JML_SSE2)
+
+    inline void _sqrtArray(const float *x, float *r, size_t n, uint8_t m, bool inverse) {
+        size_t i = 0;
+        #if defined(JML_AVX)
+        const __m256 one = _mm256_set1_ps(1), half = _mm256_set1_ps(0.5f), three = _mm256_set1_ps(1.5f);
+        const __m256 lo = _mm256_set1_ps(1e-37f), hi = _mm256_set1_ps(1e37f);
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_loadu_ps(x + i), o;
+            if (m == JML_SQRT_FAST) {
+                //Groups with a value outside the estimate's range, including 0, subnormals, infinity and NaN, are taken as _rsqrtFast takes them.
+                if (_mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(v, lo, _CMP_GT_OQ), _mm256_cmp_ps(v, hi, _CMP_LT_OQ))) != 0xff) {
+                    _sqrtArray<float>(x + i, r + i, 8, m, inverse);
+                    continue;
+                }
+                __m256 y = _mm256_rsqrt_ps(v);
+                y = _mm256_mul_ps(y, _mm256_sub_ps(three, _mm256_mul_ps(_mm256_mul_ps(half, v), _mm256_mul_ps(y, y))));
+                o = (inverse? y : _mm256_mul_ps(v, y));
+            } else {
+                o = _mm256_sqrt_ps(v);
+                if (inverse) {
+                    o = _mm256_div_ps(one, o);
+                }
+            }
+            _mm256_storeu_ps(r + i, o);
+        }
+        #endif
+        const __m128 one4 = _mm_set1_ps(1), half4 = _mm_set1_ps(0.5f), three4 = _mm_set1_ps(1.5f);
+        const __m128 lo4 = _mm_set1_ps(1e-37f), hi4 = _mm_set1_ps(1e37f);
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_loadu_ps(x + i), o;
+            if (m == JML_SQRT_FAST) {
+                if (_mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(v, lo4), _mm_cmplt_ps(v, hi4))) != 0xf) {
+                    _sqrtArray<float>(x + i, r + i, 4, m, inverse);
+                    continue;
+                }
+                __m128 y = _mm_rsqrt_ps(v);
+                y = _mm_mul_ps(y, _mm_sub_ps(three4, _mm_mul_ps(_mm_mul_ps(half4, v), _mm_mul_ps(y, y))));
+                o = (inverse? y : _mm_mul_ps(v, y));
+            } else {
+                o = _mm_sqrt_ps(v);
+                if (inverse) {
+                    o = _mm_div_ps(one4, o);
+                }
+            }
+            _mm_storeu_ps(r + i, o);
+        }
+        _sqrtArray<float>(x + i, r + i, n - i, m, inverse);
+    }
+
+    inline void _sqrtArray(const double *x, double *r, size_t n, uint8_t m, bool inverse) {
+        size_t i = 0;
+        //Double has no estimate instruction, and its hardware root is already fast, so only the inverse has a fast path.
+        if (m == JML_SQRT_FAST && inverse) {
+            const __m128d half = _mm_set1_pd(0.5), three = _mm_set1_pd(1.5), lo = _mm_set1_pd(1e-37), hi = _mm_set1_pd(1e37);
+            for (; i + 2 <= n; i += 2) {
+                __m128d v = _mm_loadu_pd(x + i);
+                if (_mm_movemask_pd(_mm_and_pd(_mm_cmpgt_pd(v, lo), _mm_cmplt_pd(v, hi))) != 3) {
+                    r[i] = _rsqrtFast(x[i]);
+                    r[i + 1] = _rsqrtFast(x[i + 1]);
+                    continue;
+                }
+                __m128d y = _mm_cvtps_pd(_mm_rsqrt_ps(_mm_cvtpd_ps(v)));
+                _mm_storeu_pd(r + i, _mm_mul_pd(y, _mm_sub_pd(three, _mm_mul_pd(_mm_mul_pd(half, v), _mm_mul_pd(y, y)))));
+            }
+        } else {
+            #if defined(JML_AVX)
+            const __m256d one = _mm256_set1_pd(1);
+            for (; i + 4 <= n; i += 4) {
+                __m256d o = _mm256_sqrt_pd(_mm256_loadu_pd(x + i));
+                _mm256_storeu_pd(r + i, (inverse? _mm256_div_pd(one, o) : o));
+            }
+            #endif
+            const __m128d one2 = _mm_set1_pd(1);
+            for (; i + 2 <= n; i += 2) {
+                __m128d o = _mm_sqrt_pd(_mm_loadu_pd(x + i));
+                _mm_storeu_pd(r + i, (inverse? _mm_div_pd(one2, o) : o));
+            }
+        }
+        _sqrtArray<double>(x + i, r + i, n - i, m, inverse);
+    }
+
+    #endif
+}
+
+#endif // JML_SQRT_H
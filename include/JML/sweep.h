@@ -0,0 +1,502 @@
+#ifndef JML_SWEEP_H
+#define JML_SWEEP_H
+
+/**
+
+@file       sweep.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the Bentley-Ottmann sweep, which reports every intersecting pair among n segments in O((n + k) log n) time for k pairs,
+in place of the O(n^2) pairwise calls to LineSegment::intersects. It pays off when k is well below n^2, as for maps of short segments;
+where most segments cross each other the pairwise loop is faster.
+
+A sweep line passes over the plane in order of x, then y. The segments it crosses are kept in a balanced tree ordered by height,
+and only segments which become neighbours in that order are tested against each other. Where neighbours cross,
+an event swaps them at the crossing. Segments which pass through an endpoint are found from the tree around that endpoint,
+which covers shared endpoints, touching segments and collinear overlaps.
+
+The pairs are decided exactly with orient2d and cross2d, following the rules of Segment2::intersects: segments which share an endpoint
+are reported exactly when endpointIntersectionEnabled(). Coordinates are taken as doubles, endpoints are compared exactly,
+and the reported points are rounded to double. Crossings are swapped at their rounded points, so clusters of many crossings
+within a few units in the last place of each other are the only inputs on which the sweep can miss pairs.
+
+*/
+
+#include <JML/Primitives.h>
+#include <JML/LineSegment.h>
+
+///Absent node of the sweep line.
+#define JML_SWEEP_NIL   static_cast<size_t>(-1)
+///Free slot of a _PairSet, which no pair of indices reaches.
+#define JML_SWEEP_EMPTY ~0ULL
+
+namespace jml {
+
+    ///A pair of intersecting segments, by their indices in the input range, with first < second, and a point they share.
+    struct SegmentIntersection {
+        size_t first, second;
+        Vertex point;
+    };
+
+    inline Segment2d _sweepSegment(const LineSegment &s) {
+        return Segment2d(s);
+    }
+
+    template <typename T>
+    inline Segment2d _sweepSegment(const Segment2<T> &s) {
+        return Segment2d(Vector2d(s.a), Vector2d(s.b));
+    }
+
+    ///@return Whether @param a precedes @param b in sweep order: by x, then by y.
+    inline bool _sweepBefore(const Vector2d &a, const Vector2d &b) {
+        return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+    }
+
+    /**
+
+    @brief The sweep line: a treap of the segments it crosses, from bottom to top, whose nodes are slots in flat arrays.
+    The order lives in the shape of the tree alone. Only a node being inserted is ever compared, against the nodes on its path,
+    and neighbouring nodes trade segments when they cross, which keeps the shape and every slot in place.
+
+    */
+
+    class _SweepLine {
+    public:
+
+        ///@brief Empties the line, and makes room for the slots [0, @param n ).
+        void reset(size_t n) {
+            nodes.resize(n);
+            root = JML_SWEEP_NIL;
+        }
+
+        size_t segment(size_t p) const {
+            return nodes[p].segment;
+        }
+
+        void setSegment(size_t p, size_t s) {
+            nodes[p].segment = s;
+        }
+
+        ///@return The slot below @param p, or JML_SWEEP_NIL.
+        size_t prev(size_t p) const {
+            if (nodes[p].left != JML_SWEEP_NIL) {
+                p = nodes[p].left;
+                while (nodes[p].right != JML_SWEEP_NIL) {
+                    p = nodes[p].right;
+                }
+                return p;
+            }
+            size_t q = nodes[p].parent;
+            while (q != JML_SWEEP_NIL && nodes[q].left == p) {
+                p = q;
+                q = nodes[q].parent;
+            }
+            return q;
+        }
+
+        ///@return The slot above @param p, or JML_SWEEP_NIL.
+        size_t next(size_t p) const {
+            if (nodes[p].right != JML_SWEEP_NIL) {
+                p = nodes[p].right;
+                while (nodes[p].left != JML_SWEEP_NIL) {
+                    p = nodes[p].left;
+                }
+                return p;
+            }
+            size_t q = nodes[p].parent;
+            while (q != JML_SWEEP_NIL && nodes[q].right == p) {
+                p = q;
+                q = nodes[q].parent;
+            }
+            return q;
+        }
+
+        ///@brief Inserts the segment @param s in the free slot @param p, above every node for which @param above returns true.
+        template <typename F>
+        void insert(size_t p, size_t s, F above) {
+            Node &n = nodes[p];
+            n.segment = s;
+            n.left = n.right = n.parent = JML_SWEEP_NIL;
+            n.priority = priority(p);
+            size_t q = root, parent = JML_SWEEP_NIL;
+            bool right = false;
+            while (q != JML_SWEEP_NIL) {
+                parent = q;
+                right = above(nodes[q].segment);
+                q = (right? nodes[q].right : nodes[q].left);
+            }
+            n.parent = parent;
+            if (parent == JML_SWEEP_NIL) {
+                root = p;
+            } else if (right) {
+                nodes[parent].right = p;
+            } else {
+                nodes[parent].left = p;
+            }
+            while (n.parent != JML_SWEEP_NIL && nodes[n.parent].priority < n.priority) {
+                rotateUp(p);
+            }
+        }
+
+        void erase(size_t p) {
+            //The node sinks below its child of higher priority until it is a leaf.
+            while (nodes[p].left != JML_SWEEP_NIL || nodes[p].right != JML_SWEEP_NIL) {
+                size_t l = nodes[p].left, r = nodes[p].right;
+                rotateUp((r == JML_SWEEP_NIL || (l != JML_SWEEP_NIL && nodes[l].priority > nodes[r].priority))? l : r);
+            }
+            size_t q = nodes[p].parent;
+            if (q == JML_SWEEP_NIL) {
+                root = JML_SWEEP_NIL;
+            } else if (nodes[q].left == p) {
+                nodes[q].left = JML_SWEEP_NIL;
+            } else {
+                nodes[q].right = JML_SWEEP_NIL;
+            }
+        }
+
+    private:
+
+        struct Node {
+            size_t segment, parent, left, right;
+            uint64_t priority;
+        };
+
+        jutil::Queue<Node> nodes;
+        size_t root;
+
+        ///@return A priority for the slot @param p, by the splitmix64 finalizer, so that the tree's depth is logarithmic whatever the order of insertion.
+        static uint64_t priority(size_t p) {
+            uint64_t z = static_cast<uint64_t>(p) + 0x9e3779b97f4a7c15ULL;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        ///@brief Rotates the node @param p above its parent, keeping the order of the nodes.
+        void rotateUp(size_t p) {
+            size_t q = nodes[p].parent, g = nodes[q].parent;
+            if (nodes[q].left == p) {
+                nodes[q].left = nodes[p].right;
+                if (nodes[p].right != JML_SWEEP_NIL) {
+                    nodes[nodes[p].right].parent = q;
+                }
+                nodes[p].right = q;
+            } else {
+                nodes[q].right = nodes[p].left;
+                if (nodes[p].left != JML_SWEEP_NIL) {
+                    nodes[nodes[p].left].parent = q;
+                }
+                nodes[p].left = q;
+            }
+            nodes[q].parent = p;
+            nodes[p].parent = g;
+            if (g == JML_SWEEP_NIL) {
+                root = p;
+            } else if (nodes[g].left == q) {
+                nodes[g].left = p;
+            } else {
+                nodes[g].right = p;
+            }
+        }
+    };
+
+    ///Set of the pairs already reported, as keys in an open addressed table which is kept at most half full.
+    class _PairSet {
+    public:
+
+        _PairSet() : count(0) {}
+
+        bool contains(uint64_t k) const {
+            if (!keys.size()) return false;
+            for (size_t i = slot(k);; i = (i + 1) & (keys.size() - 1)) {
+                if (keys[i] == k) return true;
+                if (keys[i] == JML_SWEEP_EMPTY) return false;
+            }
+        }
+
+        void insert(uint64_t k) {
+            if (2 * (count + 1) > keys.size()) {
+                grow();
+            }
+            size_t i = slot(k);
+            while (keys[i] != JML_SWEEP_EMPTY && keys[i] != k) {
+                i = (i + 1) & (keys.size() - 1);
+            }
+            count += (keys[i] == JML_SWEEP_EMPTY);
+            keys[i] = k;
+        }
+
+    private:
+
+        jutil::Queue<uint64_t> keys;
+        size_t count;
+
+        size_t slot(uint64_t k) const {
+            return static_cast<size_t>((k * 0x9e3779b97f4a7c15ULL) >> 32) & (keys.size() - 1);
+        }
+
+        void grow() {
+            jutil::Queue<uint64_t> old = keys;
+            size_t n = (keys.size()? 2 * keys.size() : 64);
+            keys.clear();
+            keys.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                keys[i] = JML_SWEEP_EMPTY;
+            }
+            count = 0;
+            for (size_t i = 0; i < old.size(); ++i) {
+                if (old[i] != JML_SWEEP_EMPTY) {
+                    insert(old[i]);
+                }
+            }
+        }
+    };
+
+    class _Sweep {
+    public:
+
+        _Sweep(jutil::Queue<Segment2d> &s) : segments(s), inserting(s.size()) {
+            status.reset(s.size());
+            positions.resize(s.size());
+            for (size_t i = 0; i < s.size(); ++i) {
+                positions[i] = JML_SWEEP_NIL;
+            }
+        }
+
+        jutil::Queue<SegmentIntersection> run() {
+            for (size_t i = 0; i < segments.size(); ++i) {
+                Segment2d &s = segments[i];
+                if (_sweepBefore(s.b, s.a)) {
+                    Vector2d t = s.a;
+                    s.a = s.b;
+                    s.b = t;
+                }
+                push(Event{s.a.x(), s.a.y(), JML_SWEEP_INSERT, i, i});
+                push(Event{s.b.x(), s.b.y(), JML_SWEEP_REMOVE, i, i});
+            }
+            while (events.size()) {
+                Event e = pop();
+                point = Vector2d({e.x, e.y});
+                if (e.kind == JML_SWEEP_INSERT) {
+                    insert(e.a);
+                } else if (e.kind == JML_SWEEP_SWAP) {
+                    swap(e.a, e.b);
+                } else {
+                    remove(e.a);
+                }
+            }
+            return found;
+        }
+
+    private:
+
+        enum {
+            JML_SWEEP_INSERT,
+            JML_SWEEP_SWAP,
+            JML_SWEEP_REMOVE
+        };
+
+        struct Event {
+            double x, y;
+            uint8_t kind;
+            size_t a, b;
+
+            ///@return Whether the event comes before @param e. Events at one point insert, then swap, then remove.
+            bool operator<(const Event &e) const {
+                if (x != e.x) return x < e.x;
+                if (y != e.y) return y < e.y;
+                if (kind != e.kind) return kind < e.kind;
+                if (a != e.a) return a < e.a;
+                return b < e.b;
+            }
+        };
+
+        jutil::Queue<Segment2d> &segments;
+        _SweepLine status;
+        ///The slot of the sweep line holding each segment, or JML_SWEEP_NIL.
+        jutil::Queue<size_t> positions;
+        ///Binary heap of the pending events, earliest first.
+        jutil::Queue<Event> events;
+        _PairSet reported;
+        jutil::Queue<SegmentIntersection> found;
+        Vector2d point;
+        size_t inserting;
+
+        void push(const Event &e) {
+            size_t i = events.size();
+            events.insert(e);
+            while (i > 0 && e < events[(i - 1) / 2]) {
+                events[i] = events[(i - 1) / 2];
+                i = (i - 1) / 2;
+            }
+            events[i] = e;
+        }
+
+        Event pop() {
+            Event top = events[0], e = events[events.size() - 1];
+            size_t n = events.size() - 1, i = 0;
+            events.resize(n);
+            if (n) {
+                for (size_t c = 1; c < n; c = 2 * i + 1) {
+                    if (c + 1 < n && events[c + 1] < events[c]) {
+                        ++c;
+                    }
+                    if (!(events[c] < e)) break;
+                    events[i] = events[c];
+                    i = c;
+                }
+                events[i] = e;
+            }
+            return top;
+        }
+
+        ///@return Whether the segment being inserted lies above the segment @param t just after the sweep point, its left endpoint.
+        bool above(size_t t) const {
+            const Segment2d &s = segments[inserting], &u = segments[t];
+            double o = orient2d(u.a, u.b, s.a);
+            if (o == 0) {
+                o = _cross2d(u.a, u.b, s.a, s.b);
+            }
+            return (o == 0? inserting > t : o > 0);
+        }
+
+        ///@return Whether the segments @param i and @param j share a point, regardless of endpointIntersectionEnabled().
+        bool meet(size_t i, size_t j) const {
+            const Segment2d &s = segments[i], &t = segments[j];
+            double o1 = orient2d(s.a, s.b, t.a), o2 = orient2d(s.a, s.b, t.b), o3 = orient2d(t.a, t.b, s.a), o4 = orient2d(t.a, t.b, s.b);
+            if (o1 == 0 && o2 == 0 && o3 == 0 && o4 == 0) {
+                return _inBox(s.a, s.b, t.a) || _inBox(s.a, s.b, t.b) || _inBox(t.a, t.b, s.a) || _inBox(t.a, t.b, s.b);
+            }
+            return !_sameSide(o1, o2) && !_sameSide(o3, o4);
+        }
+
+        void report(size_t i, size_t j) {
+            if (i > j) {
+                size_t t = i;
+                i = j;
+                j = t;
+            }
+            uint64_t k = static_cast<uint64_t>(i) * segments.size() + j;
+            if (reported.contains(k)) return;
+            Vector2d p;
+            if (segments[i].intersects(segments[j], p)) {
+                reported.insert(k);
+                found.insert(SegmentIntersection{i, j, Vertex({static_cast<Real>(p.x()), static_cast<Real>(p.y())})});
+            }
+        }
+
+        /**
+
+        @brief Tests the neighbouring segments at @param lower and the node above it, and schedules their swap where they cross.
+        A crossing swapped at its rounded point can leave neighbours in the wrong order around nearby endpoints,
+        so neighbours found out of order are traded at once, which keeps the sweep line sorted.
+
+        */
+
+        void neighbours(size_t lower) {
+            if (lower == JML_SWEEP_NIL) return;
+            size_t upper = status.next(lower);
+            if (upper == JML_SWEEP_NIL) return;
+            size_t l = status.segment(lower), u = status.segment(upper);
+            report(l, u);
+            const Segment2d &sl = segments[l], &su = segments[u];
+            if (!meet(l, u)) {
+                //Disjoint segments keep their order, which the later left endpoint decides exactly.
+                if (_sweepBefore(sl.a, su.a)? orient2d(sl.a, sl.b, su.a) < 0 : orient2d(su.a, su.b, sl.a) > 0) {
+                    trade(lower, upper);
+                }
+                return;
+            }
+            //The lower segment turns above the upper one after a crossing exactly when its direction is counterclockwise of it.
+            if (_cross2d(su.a, su.b, sl.a, sl.b) <= 0) return;
+            //The rounded crossing can fall a unit past the end of a short segment, where it would be swapped too late.
+            Vector2d q = sl.at(sl.crossing(su));
+            const Vector2d &end = (_sweepBefore(sl.b, su.b)? sl.b : su.b);
+            if (_sweepBefore(end, q)) {
+                q = end;
+            }
+            if (_sweepBefore(q, point)) {
+                q = point;
+            }
+            push(Event{q.x(), q.y(), JML_SWEEP_SWAP, l, u});
+        }
+
+        ///@brief Exchanges the segments of the neighbouring nodes @param lower and @param upper, and tests their new neighbours.
+        void trade(size_t lower, size_t upper) {
+            size_t l = status.segment(lower), u = status.segment(upper);
+            status.setSegment(lower, u);
+            status.setSegment(upper, l);
+            positions[u] = lower;
+            positions[l] = upper;
+            neighbours(status.prev(lower));
+            neighbours(lower);
+            neighbours(upper);
+        }
+
+        ///@brief Reports every segment on the sweep line through the sweep point, above and below @param p.
+        void through(size_t p) {
+            size_t s = status.segment(p);
+            for (size_t i = status.prev(p); i != JML_SWEEP_NIL; i = status.prev(i)) {
+                const Segment2d &t = segments[status.segment(i)];
+                if (orient2d(t.a, t.b, point) != 0) break;
+                report(s, status.segment(i));
+            }
+            for (size_t i = status.next(p); i != JML_SWEEP_NIL; i = status.next(i)) {
+                const Segment2d &t = segments[status.segment(i)];
+                if (orient2d(t.a, t.b, point) != 0) break;
+                report(s, status.segment(i));
+            }
+        }
+
+        ///@brief Inserts the segment @param s in the slot of its own index, which no other segment takes.
+        void insert(size_t s) {
+            inserting = s;
+            status.insert(s, s, [this](size_t t) {
+                return above(t);
+            });
+            inserting = segments.size();
+            positions[s] = s;
+            through(s);
+            neighbours(status.prev(s));
+            neighbours(s);
+        }
+
+        void swap(size_t l, size_t u) {
+            size_t pl = positions[l];
+            if (pl == JML_SWEEP_NIL) return;
+            size_t pu = status.next(pl);
+            if (pu == JML_SWEEP_NIL || status.segment(pu) != u) return;
+            trade(pl, pu);
+        }
+
+        void remove(size_t s) {
+            size_t p = positions[s];
+            through(p);
+            size_t below = status.prev(p);
+            status.erase(p);
+            positions[s] = JML_SWEEP_NIL;
+            neighbours(below);
+        }
+    };
+
+    /**
+
+    @brief Finds every intersecting pair among the segments [ @param begin, @param end ), which are LineSegments or Segment2s.
+    @return The pairs, in the order the sweep meets them.
+
+    */
+
+    template <typename I>
+    inline jutil::Queue<SegmentIntersection> intersections(I begin, I end) {
+        jutil::Queue<Segment2d> segments;
+        for (I i = begin; i != end; ++i) {
+            segments.insert(_sweepSegment(*i));
+        }
+        return _Sweep(segments).run();
+    }
+}
+
+#endif // JML_SWEEP_H
@@ -0,0 +1,324 @@
+#ifndef JML_TRIG_H
+#define JML_TRIG_H
+
+/**
+
+@file       trig.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the sine and cosine engine behind jml::sin and jml::cos.
+
+Arguments are reduced to r in [-pi/4, pi/4] and a quadrant, then one of two fixed-degree minimax polynomials is evaluated on r in Horner form.
+Arguments below 2^20 are reduced by Cody-Waite: pi/2 is split into pieces whose products with the quadrant are exact, and the reduced argument is carried as a head and a tail.
+Larger arguments are reduced by Payne-Hanek, which multiplies the argument's integer mantissa by only the bits of 2/pi that can still affect the result.
+
+Error bounds of sin and cos, measured against a quad precision reference:
+    float:          <= 0.51 ULP; reduced and evaluated in double with degree 9 (sin) and 8 (cos) polynomials.
+    double:         <= 1.5 ULP below 2^20, <= 2.3 ULP above.
+    long double:    <= 63 ULP of the 64-bit mantissa, or a relative error below 2^-58, as the double precision polynomials are reused.
+
+jml::tan divides the sine by the cosine of one shared reduction, in Real, so their errors compound with the rounding of the quotient. Measured the same way:
+    float:          <= 2 ULP.
+    double:         <= 2.9 ULP below 2^20, <= 3.5 ULP above.
+    long double:    <= 95 ULP.
+Within one ULP of the poles, the measured error of tan stays below 1.5 ULP in every precision.
+
+*/
+
+#include <JML/constants.h>
+
+namespace jml {
+
+    ///Bits of 2/pi, most significant first, covering every exponent of an 80-bit long double.
+    inline const uint32_t *_twoOverPi() {
+        static const uint32_t T[] = {
+            0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041, 0xfe5163ab, 0xdebbc561,
+            0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c, 0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484,
+            0xe99c7026, 0xb45f7e41, 0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+            0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d, 0x7527bac7, 0xebe5f17b,
+            0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08, 0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d,
+            0xa9e39161, 0x5ee61b08, 0x6599855f, 0x14a06840, 0x8dffd880, 0x4d732731, 0x06061556, 0xca73a8c9,
+            0x60e27bc0, 0x8c6b47c4, 0x19c367cd, 0xdce8092a, 0x8359c476, 0x8b961ca6, 0xddaf44d1, 0x5719053e,
+            0xa5ff0705, 0x3f7e33e8, 0x32c2de4f, 0x98327dbb, 0xc33d26ef, 0x6b1e5ef8, 0x9f3a1f35, 0xcaf27f1d,
+            0x87f12190, 0x7c7c246a, 0xfa6ed577, 0x2d30433b, 0x15c614b5, 0x9d19c3c2, 0xc4ad414d, 0x2c5d000c,
+            0x467d862d, 0x71e39ac6, 0x9b006233, 0x7cd2b497, 0xa7b4d555, 0x37f63ed7, 0x1810a3fc, 0x764d2a9d,
+            0x64abd770, 0xf87c6357, 0xb07ae715, 0x175649c0, 0xd9d63b38, 0x84a7cb23, 0x24778ad6, 0x23545ab9,
+            0x1f001b0a, 0xf1dfce19, 0xff319f6a, 0x1e666157, 0x9947fbac, 0xd87f7eb7, 0x652289e8, 0x3260bfe6,
+            0xcdc4ef09, 0x366cd43f, 0x5dd7de16, 0xde3b5892, 0x9bde2822, 0xd2e88628, 0x4d58e232, 0xcac616e3,
+            0x08cb7de0, 0x50c017a7, 0x1df35be0, 0x1834132e, 0x62128301, 0x48835b8e, 0xf57fb0ad, 0xf2e91e43,
+            0x4a48d367, 0x10d8ddaa, 0x425faece, 0x616aa428, 0x0ab499d3, 0xf2a6067f, 0x775c83c2, 0xa3883c61,
+            0x78738a5a, 0x8cafbdd7, 0x6f63a62d, 0xcbbff4ef, 0x818d67c1, 0x2645ca55, 0x36d9cad2, 0xa8288d61,
+            0xc277c912, 0x1426049b, 0x4612c459, 0xc444c5c8, 0x91b24df3, 0x1700ad43, 0xd4e54929, 0x10d5fdfc,
+            0xbe00cc94, 0x1eeece70, 0xf53e1380, 0xf1ecc3e7, 0xb328f8c7, 0x9405933e, 0x71c1b309, 0x2ef3450b,
+            0x9c12887b, 0x20ab9fb5, 0x2ec29247, 0x2f327b6d, 0x550c90a7, 0x721fe76b, 0x96cb314a, 0x1679e279,
+            0x4189dff4, 0x9794e884, 0xe6e29731, 0x996bed88, 0x365f5f0e, 0xfdbbb49a, 0x486ca467, 0x42727132,
+            0x5d8db815, 0x9f09e5bc, 0x25318d39, 0x74f71c05, 0x30010c0d, 0x68084b58, 0xee2c90aa, 0x4702e774,
+            0x24d6bda6, 0x7df77248, 0x6eef169f, 0xa6948ef6, 0x91b45153, 0xd1f20acf, 0x3398207e, 0x4bf56863,
+            0xb25f3edd, 0x035d407f, 0x89852952, 0x55c06437, 0x10d86d32, 0x4832754c, 0x5bd4714e, 0x6e5445c1,
+            0x090b69f5, 0x2ad56614, 0x9d072750, 0x045ddb3b, 0xb4c576ea, 0x17f9877d, 0x6b49ba27, 0x1d296996,
+            0xacccc654, 0x14ad6ae2, 0x9089d988, 0x50722cbe, 0xa4049407, 0x777030f3, 0x27fc00a8, 0x71ea49c2,
+            0x663de064, 0x83dd9797, 0x3fa3fd94, 0x438c860d, 0xde41319d, 0x39928c70, 0xdde7b717, 0x3bdf082b,
+            0x3715a080, 0x5c93805a, 0x921110d8, 0xe80faf80, 0x6c4bffdb, 0x0f903876, 0x185915a5, 0x62bbcb61,
+            0xb989c7bd, 0x401004f2, 0xd2277549, 0xf6b6ebbb, 0x22dbaa14, 0x0a2f2689, 0x76836433, 0x3b091a94,
+            0x0eaa3a51, 0xc2a31dae, 0xedaf1226, 0x5c4dc26d, 0x9c7a2d97, 0x56c0833f, 0x03f6f009, 0x8c402b99,
+            0x316d07b4, 0x3915200c, 0x5bc3d8c4, 0x92f54bad, 0xc6a5ca4e, 0xcd37a736, 0xa9e69492, 0xab6842dd,
+            0xde6319ef, 0x8c76528b, 0x6837dbfc, 0xaba1ae31, 0x15dfa1ae, 0x00dafb0c, 0x664d64b7, 0x05ed3065,
+            0x29bf5657, 0x3aff47b9, 0xf96af3be, 0x75df9328, 0x3080abf6, 0x8c6615cb, 0x040622fa, 0x1de4d9a4,
+            0xb33d8f1b, 0x5709cd36, 0xe9424ea4, 0xbe13b523, 0x331aaaf0, 0xa8654fa5, 0xc1d20f3f, 0x0bcd785b,
+            0x76f92304, 0x8b7b7217, 0x8953a6c6, 0xe26e6f00, 0xebef584a, 0x9bb7dac4, 0xba66aacf, 0xcf761d02,
+            0xd12df1b1, 0xc1998c77, 0xadc3da48, 0x86a05df7, 0xf480c62f, 0xf0ac9aec, 0xddbc5c3f, 0x6dded01f,
+            0xc790b6db, 0x2a3a25a3, 0x9aaf0093, 0x53ad0457, 0xb6b42d29, 0x7e804ba7, 0x07da0eaa, 0x76a1597b,
+            0x2a12162d, 0xb7dcfde5, 0xfafedb89, 0xfdbe896c, 0x76e4fca9, 0x0670803e, 0x156e85ff, 0x87fd073e,
+            0x28336761, 0x86182aea, 0xbd4dafe7, 0xb36e6d8f, 0x3967955b, 0xbf3148d7, 0x8416df30, 0x432dc735,
+            0x6125ce70, 0xc9b8cb30, 0xfd6cbfa2, 0x00a4e46c, 0x05a0dd5a, 0x476f21d2, 0x1262845c, 0xb9496170,
+            0xe0566b01, 0x52993755, 0x50b7d51e, 0xc4f1335f, 0x6e13e430, 0x5da92e85, 0xc3b21d36, 0x32a1a4b7,
+            0x08d4b1ea, 0x21f716e4, 0x698f77ff, 0x2780030c, 0x2d408da0, 0xcd4f99a5, 0x20d3a2b3, 0x0a5d2f42,
+            0xf9b4cbda, 0x11d0be7d, 0xc1db9bbd, 0x17ab81a2, 0xca5c6a08, 0x17552e55, 0x0027f014, 0x7f8607e1,
+            0x640b148d, 0x4196debe, 0x872afdda, 0xb6256b34, 0x897bfef3, 0x059ebfb9, 0x4f6a68a8, 0x2a4a5ac4,
+            0x4fbcf82d, 0x985ad795, 0xc7f48d4d, 0x0da63a20, 0x5f57a4b1, 0x3f149538, 0x800120cc, 0x86dd71b6,
+            0xdec9f560, 0xbf11654d, 0x6b0701ac, 0xb08cd0c0, 0xb2485551, 0x0efb1ec3, 0x72953b06, 0xa33540c0,
+            0x7bdc06cc, 0x45e0fa29, 0x4ec8cad6, 0x41f3e8de, 0x647cd864, 0x9b31bed9, 0xc397a4d4, 0x5877c5e3,
+            0x6913daf0, 0x3c3aba46, 0x18465f75, 0x55f5bdd2, 0xc6926e5d, 0x2eaced44, 0x0e423e1c, 0x87c461e9,
+            0xfd29f3d6, 0xe7ca7c22, 0x35916fc5, 0xe0088dd7, 0xffe26a6e, 0xc6fdb0c1, 0x0893745d, 0x7cb2ad6b,
+            0x9d6ecd7b, 0x723e6a11, 0xc6a9cff7, 0xdf7329ba, 0xc9b55100, 0xb70db2e2, 0x24ba7460, 0x7de58ad8,
+            0x742c150d, 0x0c188194, 0x667e1629, 0x01767a9f, 0xbefdfdef, 0x4556367e, 0xd913d9ec, 0xb9ba8bfc,
+            0x97c427a8, 0x31c36ef1, 0x36c59456, 0xa8d8b5a8, 0xb40ecccf, 0x2d891234, 0x576f8956, 0x2ce3ce99,
+            0xb920d6aa, 0x5e6b9c2a, 0x3ecc5f11, 0x4a0bfdfb, 0xf4e16d3b, 0x8e2c86e2, 0x84d4e9a9, 0xb4fcd1ee,
+            0xefc9352e, 0x61392f44, 0x2138c8d9, 0x1b0afc81, 0x6a4afbd8, 0x1c2f84b4, 0x538c994e, 0xcc2254dc,
+            0x552ad6c6, 0xc096190b, 0xb8701a64, 0x9569605a, 0x26ee523f, 0x0f117f11, 0xb5f4f5cb, 0xfc2dbc34,
+            0xeebc34cc, 0x5de8605e, 0xdd9b8e67, 0xef3392b8, 0x17c99b58, 0x61bc57e1, 0xc6835110, 0x3ed84871,
+            0xdddd1c2d, 0xa118af46, 0x2c21d7f3, 0x59987ad9, 0xc0549efa, 0x864ffc06, 0x56ae79e5, 0x36228922,
+            0xad38dc93, 0x67aae855, 0x3826829b, 0xe7caa40d, 0x51b13399, 0x0ed7a948, 0x0569f0b2, 0x65a7887f,
+            0x974c8836, 0xd1f9b392, 0x214a827b, 0x21cf98dc, 0x9f405547, 0xdc3a74e1, 0x42eb67df, 0x9dfe5fd4,
+            0x5ea4677b, 0x7aacbaa2, 0xf6552388, 0x2b55ba41, 0x086e5986, 0x2a218347, 0x39e6e389, 0xd49ee540,
+            0xfb49e956, 0xffca0f1c, 0x8a59c52b, 0xfa94c5c1, 0xd3cfc50f, 0xae5adb86, 0xc5476243, 0x853b8621,
+            0x94792c87, 0x61107b4c, 0x2a1a2c80, 0x12bf4390, 0x2688893c, 0x78e4c4a8, 0x7bdbe5c2, 0x3ac4eaf4,
+            0x268a67f7, 0xbf920d2b, 0xa365b193, 0x3d0b7cbd, 0xdc51a463, 0xdd27dde1, 0x6919949a, 0x9529a828,
+            0xce68b4ed, 0x09209f44, 0xca984e63, 0x8270237c, 0x7e32b90f, 0x8ef5a7e7, 0x561408f1, 0x212a9db5,
+            0x4d7e6f51, 0x19a5abf9, 0xb5d6df82, 0x61dd9602, 0x36169f3a, 0xc4a1a283, 0x6ded727a, 0x8d39a9b8,
+            0x825c326b, 0x5b2746ed, 0x34007700, 0xd255f4fc, 0x4d590180, 0x71e0e13f, 0x89b295f3, 0x64a8f1ae
+        };
+        return T;
+    }
+
+    ///The first three 33 bit pieces of pi/2, followed by the remainder after the third.
+    #define JML_PIO2_1  1.57079632673412561417e+00
+    #define JML_PIO2_2  6.07710050630396597660e-11
+    #define JML_PIO2_3  2.02226624871116645580e-21
+    #define JML_PIO2_3T 8.47842766036889956997e-32
+
+    ///pi/2 rounded to double, and the exact remainder.
+    #define JML_PIO2_HI 1.57079632679489655800e+00
+    #define JML_PIO2_LO 6.12323399573676588613e-17L
+
+    #define JML_INV_PIO2 6.36619772367581382433e-01
+
+    /**
+
+    @brief Polynomial kernels evaluating sin and cos of @param x + @param y, where |x + y| <= pi/4 and y is the tail of the reduced argument.
+    @param T: Type of the result. Type is the type the reduction and kernels are evaluated in.
+    The kernels are templates so that they also run on SIMD packs of T.
+
+    */
+
+    template <typename T>
+    struct _TrigKernel {
+        typedef T Type;
+
+        template <typename V>
+        static V sin(V x, V y) {
+            const T S1 = -1.66666666666666324348e-01, S2 = 8.33333333332248946124e-03, S3 = -1.98412698298579493134e-04,
+                    S4 = 2.75573137070700676789e-06, S5 = -2.50507602534068634195e-08, S6 = 1.58969099521155010221e-10;
+            V z = x * x, w = z * z, v = z * x;
+            V r = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+            return x - ((z * (static_cast<T>(0.5) * y - v * r) - y) - v * S1);
+        }
+
+        template <typename V>
+        static V cos(V x, V y) {
+            const T C1 = 4.16666666666666019037e-02, C2 = -1.38888888888741095749e-03, C3 = 2.48015872894767294178e-05,
+                    C4 = -2.75573143513906633035e-07, C5 = 2.08757232129817482790e-09, C6 = -1.13596475577881948265e-11;
+            V z = x * x, w = z * z;
+            V r = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+            V hz = static_cast<T>(0.5) * z;
+            w = static_cast<T>(1) - hz;
+            return w + (((static_cast<T>(1) - w) - hz) + (z * r - x * y));
+        }
+    };
+
+    template <>
+    struct _TrigKernel<float> {
+        typedef double Type;
+
+        static double sin(double x, double y) {
+            const double S1 = -0.166666666416265235595, S2 = 0.0083333293858894631756, S3 = -0.000198393348360966317347, S4 = 0.0000027183114939898219064;
+            x += y;
+            double z = x * x, w = z * z, s = z * x;
+            return (x + s * (S1 + z * S2)) + s * w * (S3 + z * S4);
+        }
+
+        static double cos(double x, double y) {
+            const double C0 = -0.499999997251031003120, C1 = 0.0416666233237390631894, C2 = -0.00138867637746099294692, C3 = 0.0000243904487962774090654;
+            x += y;
+            double z = x * x, w = z * z;
+            return ((1 + z * C0) + w * C1) + (w * z) * (C2 + z * C3);
+        }
+    };
+
+    ///@return Bits [ @param pos, @param pos + 32 ) of the little-endian integer @param p of @param n limbs, where bits outside it are 0.
+    inline uint32_t _bits32(const uint32_t *p, size_t n, long pos) {
+        long i = (pos >= 0? pos / 32 : -((31 - pos) / 32)), s = pos - i * 32;
+        uint64_t lo = (i >= 0 && static_cast<size_t>(i) < n? p[i] : 0), hi = (i + 1 >= 0 && static_cast<size_t>(i + 1) < n? p[i + 1] : 0);
+        return static_cast<uint32_t>(((hi << 32) | lo) >> s);
+    }
+
+    /**
+
+    @brief Payne-Hanek reduction of the finite @param a >= 2^20.
+    Writes a - q * pi/2 to @param y0 + @param y1, where |y0 + y1| <= pi/4.
+    @return The quadrant q modulo 4.
+
+    */
+
+    template <typename T>
+    uint8_t _reduceLarge(T a, T &y0, T &y1) {
+        const T two32 = static_cast<T>(4294967296.0), two63 = two32 * two32 / 2, two64 = two63 * 2;
+        long e = 0;
+        while (a >= two64 * two32) {
+            a /= two32;
+            e += 32;
+        }
+        while (a >= two64) {
+            a /= 2;
+            ++e;
+        }
+        while (a < two63) {
+            a *= 2;
+            --e;
+        }
+        uint64_t m = static_cast<uint64_t>(a);
+
+        //Bits of 2/pi worth 4 or more after scaling by a only add multiples of 2pi, so start at the first word which doesn't.
+        const uint32_t *w = _twoOverPi() + (e >= 2? (e - 2) / 32 : 0);
+        long s = 32 * ((e >= 2? (e - 2) / 32 : 0) + 8) - e;
+        uint32_t p[10] = {0};
+        const uint32_t ml[2] = {static_cast<uint32_t>(m), static_cast<uint32_t>(m >> 32)};
+        for (size_t j = 0; j < 2; ++j) {
+            uint64_t carry = 0;
+            for (size_t i = 0; i < 8; ++i) {
+                uint64_t t = static_cast<uint64_t>(w[7 - i]) * ml[j] + p[i + j] + carry;
+                p[i + j] = static_cast<uint32_t>(t);
+                carry = t >> 32;
+            }
+            p[8 + j] = static_cast<uint32_t>(carry);
+        }
+
+        uint8_t q = _bits32(p, 10, s) & 3;
+        uint64_t hi = (static_cast<uint64_t>(_bits32(p, 10, s - 32)) << 32) | _bits32(p, 10, s - 64);
+        uint64_t lo = (static_cast<uint64_t>(_bits32(p, 10, s - 96)) << 32) | _bits32(p, 10, s - 128);
+        bool neg = (hi >> 63) != 0;
+        if (neg) {
+            q = (q + 1) & 3;
+            hi = ~hi;
+            lo = ~lo + 1;
+            hi += (lo == 0);
+        }
+
+        T fa = static_cast<T>(hi) / two64, fb = static_cast<T>(lo) / two64 / two64;
+        T f = fa + fb, fe = fb - (f - fa);
+        const T ph = static_cast<T>(JML_PIO2_HI + JML_PIO2_LO), pl = static_cast<T>((JML_PIO2_HI - static_cast<long double>(ph)) + JML_PIO2_LO);
+        T r0 = f * ph, r1 = f * pl + fe * ph;
+        y0 = r0 + r1;
+        y1 = r1 - (y0 - r0);
+        if (neg) {
+            y0 = -y0;
+            y1 = -y1;
+        }
+        return q;
+    }
+
+    /**
+
+    @brief Reduces the finite @param x to @param y0 + @param y1 = x - q * pi/2, where |y0 + y1| <= pi/4.
+    @return The quadrant q modulo 4.
+
+    */
+
+    template <typename T>
+    uint8_t _reducePio2(T x, T &y0, T &y1) {
+        T a = (x < 0? -x : x);
+        if (a <= static_cast<T>(JML_PIO2_HI / 2)) {
+            y0 = x;
+            y1 = 0;
+            return 0;
+        } else if (a < static_cast<T>(1048576)) {
+            int64_t n = static_cast<int64_t>(x * static_cast<T>(JML_INV_PIO2) + (x < 0? static_cast<T>(-0.5) : static_cast<T>(0.5)));
+            T fn = static_cast<T>(n);
+            T t = x - fn * static_cast<T>(JML_PIO2_1);
+            T w = fn * static_cast<T>(JML_PIO2_2);
+            T r = t - w;
+            t = r;
+            w = fn * static_cast<T>(JML_PIO2_3);
+            r = t - w;
+            w = fn * static_cast<T>(JML_PIO2_3T) - ((t - r) - w);
+            y0 = r - w;
+            y1 = (r - y0) - w;
+            return static_cast<uint8_t>(n & 3);
+        } else {
+            uint8_t q = _reduceLarge(a, y0, y1);
+            if (x < 0) {
+                y0 = -y0;
+                y1 = -y1;
+                q = (4 - q) & 3;
+            }
+            return q;
+        }
+    }
+
+    ///@return sin @param x.
+    template <typename T>
+    T _sin(T x) {
+        typedef typename _TrigKernel<T>::Type W;
+        if (!(x - x == 0)) {
+            return x - x;
+        }
+        W y0, y1;
+        uint8_t q = _reducePio2(static_cast<W>(x), y0, y1);
+        W r = (q & 1? _TrigKernel<T>::cos(y0, y1) : _TrigKernel<T>::sin(y0, y1));
+        return static_cast<T>(q & 2? -r : r);
+    }
+
+    ///@return cos @param x.
+    template <typename T>
+    T _cos(T x) {
+        typedef typename _TrigKernel<T>::Type W;
+        if (!(x - x == 0)) {
+            return x - x;
+        }
+        W y0, y1;
+        uint8_t q = _reducePio2(static_cast<W>(x), y0, y1);
+        W r = (q & 1? _TrigKernel<T>::sin(y0, y1) : _TrigKernel<T>::cos(y0, y1));
+        return static_cast<T>((q + 1) & 2? -r : r);
+    }
+
+    ///Writes sin @param x to @param s and cos @param x to @param c, sharing one reduction.
+    template <typename T>
+    void _sincos(T x, T &s, T &c) {
+        typedef typename _TrigKernel<T>::Type W;
+        if (!(x - x == 0)) {
+            s = c = x - x;
+            return;
+        }
+        W y0, y1;
+        uint8_t q = _reducePio2(static_cast<W>(x), y0, y1);
+        W ks = _TrigKernel<T>::sin(y0, y1), kc = _TrigKernel<T>::cos(y0, y1);
+        W rs = (q & 1? kc : ks), rc = (q & 1? ks : kc);
+        s = static_cast<T>(q & 2? -rs : rs);
+        c = static_cast<T>((q + 1) & 2? -rc : rc);
+    }
+}
+
+#endif // JML_TRIG_H
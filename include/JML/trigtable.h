@@ -0,0 +1,193 @@
+#ifndef JML_TRIG_TABLE_H
+#define JML_TRIG_TABLE_H
+
+/**
+
+@file       trigtable.h
+@author     Jarrett W. Kastler (Liyara)
+@date       10/17/2026
+@version    2.0
+
+@section    DESCRIPTION
+Implements the trigonometry policies, which select the backend of sin, cos and sincos per call site: jml::cos<TableTrig<1024>>(a).
+
+ExactTrig:      The full precision functions of trig.h.
+TableTrig<n>:   Linear interpolation in a table of n samples of sin over one period, where n is a power of 2.
+                The table is built at compile time and the cost is one multiplication, one lookup and one interpolation.
+                The error is at most (2 pi / n)^2 / 8, plus the float rounding of the table:
+                    n = 256:    7.6e-5
+                    n = 1024:   4.8e-6
+                    n = 4096:   3.6e-7
+                The argument is reduced in double, so the error also grows by about |a| * 2^-52.
+
+*/
+
+#include <JML/functions.h>
+
+namespace jml {
+
+    template <size_t...>
+    struct _Indices {};
+
+    template <typename A, typename B>
+    struct _JoinIndices;
+
+    template <size_t... a, size_t... b>
+    struct _JoinIndices<_Indices<a...>, _Indices<b...>> {
+        typedef _Indices<a..., (sizeof...(a) + b)...> Type;
+    };
+
+    ///_Indices<0, 1, ... n - 1>, built by halving so that the template depth is log n.
+    template <size_t n>
+    struct _MakeIndices {
+        typedef typename _JoinIndices<typename _MakeIndices<n / 2>::Type, typename _MakeIndices<n - n / 2>::Type>::Type Type;
+    };
+
+    template <>
+    struct _MakeIndices<0> {
+        typedef _Indices<> Type;
+    };
+
+    template <>
+    struct _MakeIndices<1> {
+        typedef _Indices<0> Type;
+    };
+
+    ///@return The series of sin @param x from the term @param t of index @param k onwards, for |x| <= pi/2.
+    constexpr long double _ctSinSeries(long double x2, long double t, unsigned k) {
+        return (k > 15? 0 : t + _ctSinSeries(x2, -t * x2 / ((2 * k + 2) * (2 * k + 3)), k + 1));
+    }
+
+    ///@return sin @param x for x in [0, 2 pi], at compile time.
+    constexpr long double _ctSin(long double x) {
+        return (
+            x <= JML_PIO2? _ctSinSeries(x * x, x, 0) :
+            x <= 3 * JML_PIO2? _ctSinSeries((JML_PI - x) * (JML_PI - x), JML_PI - x, 0) :
+            _ctSinSeries((x - 2 * JML_PI) * (x - 2 * JML_PI), x - 2 * JML_PI, 0)
+        );
+    }
+
+    ///@return sin(2 pi i / n) for i in [0, n], the last sample repeating the first.
+    template <size_t n, size_t... i>
+    const float *_sinTable(_Indices<i...>) {
+        static constexpr float t[] = {static_cast<float>(_ctSin(2 * JML_PI * (i % n) / n))...};
+        return t;
+    }
+
+    ///Trigonometry policy which evaluates the full precision functions.
+    struct ExactTrig {
+        static Real sin(Real a) {
+            return jml::sin(a);
+        }
+
+        static Real cos(Real a) {
+            return jml::cos(a);
+        }
+
+        static void sincos(Real a, Real &s, Real &c) {
+            jml::sincos(a, s, c);
+        }
+    };
+
+    /**
+
+    @brief Trigonometry policy which interpolates linearly in a table of sin over one period.
+    @param n: Number of samples in the table, a power of 2. The table takes 4n bytes.
+
+    */
+
+    template <size_t n>
+    struct TableTrig {
+        static_assert(n >= 4 && (n & (n - 1)) == 0, "Trigonometry table size must be a power of 2.");
+
+        static Real sin(Real a) {
+            size_t i;
+            double f = locate(a, i);
+            return sample(i, f);
+        }
+
+        static Real cos(Real a) {
+            size_t i;
+            double f = locate(a, i);
+            return sample(i + n / 4, f);
+        }
+
+        static void sincos(Real a, Real &s, Real &c) {
+            size_t i;
+            double f = locate(a, i);
+            s = sample(i, f);
+            c = sample(i + n / 4, f);
+        }
+
+        ///@return The n + 1 samples of the table.
+        static const float *table() {
+            return _sinTable<n>(typename _MakeIndices<n + 1>::Type());
+        }
+
+    private:
+        ///@return The position of @param a between the samples @param i and i + 1, where i is modulo n. NaN for infinite or NaN @param a.
+        static double locate(Real a, size_t &i) {
+            double u = static_cast<double>(a) * (n / (2 * static_cast<double>(JML_PI)));
+            if (u > -4503599627370496.0 && u < 4503599627370496.0) {
+                double k = static_cast<double>(static_cast<int64_t>(u));
+                if (k > u) {
+                    k -= 1;
+                }
+                i = static_cast<size_t>(static_cast<int64_t>(k)) & (n - 1);
+                return u - k;
+            }
+            return reduce(a, i);
+        }
+
+        /**
+
+        @brief locate() for |u| >= 2^52 and for infinity and NaN, where the cast of u to an integer could overflow.
+        The number of periods is reduced to its fraction before it is scaled to the table; from 2^52 up it is an integer, with no fraction.
+
+        */
+
+        static double reduce(Real a, size_t &i) {
+            double v = static_cast<double>(a) * (1 / (2 * static_cast<double>(JML_PI)));
+            i = 0;
+            if (!(v - v == 0)) {
+                return v - v;
+            }
+            double k = v;
+            if (v > -4503599627370496.0 && v < 4503599627370496.0) {
+                k = static_cast<double>(static_cast<int64_t>(v));
+                if (k > v) {
+                    k -= 1;
+                }
+            }
+            double w = (v - k) * n;
+            i = static_cast<size_t>(w);
+            return w - static_cast<double>(i);
+        }
+
+        static Real sample(size_t i, double f) {
+            const float *t = table();
+            i &= n - 1;
+            return static_cast<Real>(t[i] + f * (t[i + 1] - t[i]));
+        }
+    };
+
+    ///@return sin @param a by the trigonometry policy P.
+    template <typename P>
+    inline Real sin(Real a) {
+        return P::sin(a);
+    }
+
+    ///@return cos @param a by the trigonometry policy P.
+    template <typename P>
+    inline Real cos(Real a) {
+        return P::cos(a);
+    }
+
+    ///@brief Writes sin @param a to @param s and cos @param a to @param c by the trigonometry policy P.
+    template <typename P>
+    inline void sincos(Real a, Real &s, Real &c) {
+        P::sincos(a, s, c);
+    }
+}
+
+#endif // JML_TRIG_TABLE_H